@@ -73,8 +73,18 @@ CoreComponent::checksum()
 isize
 CoreComponent::load(const u8 *buffer)
 {
-    assert(!isRunning());
+    return loadState<true>(buffer);
+}
+
+isize
+CoreComponent::loadUnchecked(const u8 *buffer)
+{
+    return loadState<false>(buffer);
+}
 
+template <bool checked> isize
+CoreComponent::loadState(const u8 *buffer)
+{
     const u8 *ptr = buffer;
 
     // Call the delegate
@@ -82,26 +92,31 @@ CoreComponent::load(const u8 *buffer)
 
     // Load internal state of all subcomponents
     for (CoreComponent *c : subComponents) {
-        ptr += c->load(ptr);
+        ptr += c->loadState<checked>(ptr);
     }
 
     // Load the checksum for this component
     auto hash = util::read64(ptr);
+    auto computed = hash;
 
-    // Load internal state of this component
-    ptr += _load(ptr);
+    // Load internal state of this component and compute the checksum
+    {   util::SerChecksum checksum(checked);
+
+        ptr += _load(ptr);
+        computed = checksum.hash;
+    }
 
     // Call the delegate
     ptr += didLoadFromBuffer(ptr);
     isize result = (isize)(ptr - buffer);
 
     // Check integrity
-    if (hash != _checksum() || FORCE_SNAP_CORRUPTED) {
+    if (checked && (hash != computed || FORCE_SNAP_CORRUPTED)) {
 
         debug(SNP_DEBUG, "Corrupted snapshot detected\n");
         throw VC64Error(ERROR_SNAP_CORRUPTED);
     }
-    
+
     debug(SNP_DEBUG, "Loaded %ld bytes (expected %ld)\n", result, size());
     return result;
 }
@@ -109,8 +124,6 @@ CoreComponent::load(const u8 *buffer)
 void
 CoreComponent::didLoad()
 {
-    assert(!isRunning());
-
     for (CoreComponent *c : subComponents) {
         c->didLoad();
     }
@@ -120,6 +133,18 @@ CoreComponent::didLoad()
 
 isize
 CoreComponent::save(u8 *buffer)
+{
+    return saveState<true>(buffer);
+}
+
+isize
+CoreComponent::saveUnchecked(u8 *buffer)
+{
+    return saveState<false>(buffer);
+}
+
+template <bool checked> isize
+CoreComponent::saveState(u8 *buffer)
 {
     u8 *ptr = buffer;
     
@@ -128,14 +153,19 @@ CoreComponent::save(u8 *buffer)
 
     // Save internal state of all subcomponents
     for (CoreComponent *c : subComponents) {
-        ptr += c->save(ptr);
+        ptr += c->saveState<checked>(ptr);
     }
 
-    // Save the checksum for this component
-    util::write64(ptr, _checksum());
-    
-    // Save the internal state of this component
-    ptr += _save(ptr);
+    // Reserve space for the checksum of this component
+    u8 *hashPtr = ptr;
+    ptr += 8;
+
+    // Save the internal state of this component and compute the checksum
+    {   util::SerChecksum checksum(checked);
+
+        ptr += _save(ptr);
+        util::write64(hashPtr, checked ? checksum.hash : 0);
+    }
 
     // Call the delegate
     ptr += didSaveToBuffer(ptr);
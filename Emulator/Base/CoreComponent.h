@@ -60,6 +60,11 @@ protected:
      * behaviour of the well known Java construct 'synchronized(this) { }'.
      */
     mutable util::ReentrantMutex mutex;
+
+public:
+
+    // Grants access to the mutex (e.g., to defer calls from other threads)
+    util::ReentrantMutex &getMutex() const { return mutex; }
     
 
     //
@@ -198,6 +203,21 @@ public:
     virtual isize _save(u8 *buf) = 0;
     virtual void didSave();
     virtual void _didSave() { };
+
+    /* Variants of load() and save() for states that never leave the emulator.
+     * They skip the checksums, which makes them suitable for saving and
+     * restoring the state many times per second. The checksum fields are
+     * still present in the buffer and set to zero.
+     */
+    isize loadUnchecked(const u8 *buf);
+    isize saveUnchecked(u8 *buf);
+
+private:
+
+    template <bool checked> isize loadState(const u8 *buf) throws;
+    template <bool checked> isize saveState(u8 *buf);
+
+public:
     
     /* Delegation methods called inside load() or save(). Some components
      * override these methods to add custom behavior if not all elements can be
@@ -28,6 +28,13 @@ enum_long(OPT)
     OPT_TIME_SLICES,
     OPT_AUTO_FPS,
     OPT_PROPOSED_FPS,
+    OPT_DRIVE_SYNC,
+    OPT_RUN_AHEAD,
+
+    // Rewinder
+    OPT_REWIND_HISTORY,
+    OPT_REWIND_RATE,
+    OPT_REWIND_MEMORY,
 
     // VICII
     OPT_VIC_REVISION,
@@ -37,6 +44,8 @@ enum_long(OPT)
     OPT_SATURATION,
     OPT_GRAY_DOT_BUG,
     OPT_VIC_POWER_SAVE,
+    OPT_VIC_HEADLESS,
+    OPT_VIC_INDEXED,
     
     // Sprite debugger
     OPT_HIDE_SPRITES,
@@ -70,6 +79,7 @@ enum_long(OPT)
     OPT_SID_POWER_SAVE,
     OPT_SID_ENGINE,
     OPT_SID_SAMPLING,
+    OPT_SID_PARALLEL,
     OPT_AUDPAN,
     OPT_AUDVOL,
     OPT_AUDVOLL,
@@ -132,6 +142,12 @@ struct OptionEnum : util::Reflection<OptionEnum, Option> {
             case OPT_TIME_SLICES:           return "TIME_SLICES";
             case OPT_AUTO_FPS:              return "AUTO_FPS";
             case OPT_PROPOSED_FPS:          return "PROPOSED_FPS";
+            case OPT_DRIVE_SYNC:            return "DRIVE_SYNC";
+            case OPT_RUN_AHEAD:             return "RUN_AHEAD";
+
+            case OPT_REWIND_HISTORY:        return "REWIND_HISTORY";
+            case OPT_REWIND_RATE:           return "REWIND_RATE";
+            case OPT_REWIND_MEMORY:         return "REWIND_MEMORY";
 
             case OPT_VIC_REVISION:          return "VIC_REVISION";
             case OPT_PALETTE:               return "PALETTE";
@@ -140,6 +156,8 @@ struct OptionEnum : util::Reflection<OptionEnum, Option> {
             case OPT_SATURATION:            return "SATURATION";
             case OPT_GRAY_DOT_BUG:          return "GRAY_DOT_BUG";
             case OPT_VIC_POWER_SAVE:        return "VIC_POWER_SAVE";
+            case OPT_VIC_HEADLESS:          return "VIC_HEADLESS";
+            case OPT_VIC_INDEXED:           return "VIC_INDEXED";
                 
             case OPT_HIDE_SPRITES:          return "HIDE_SPRITES";
             case OPT_CUT_LAYERS:            return "CUT_LAYERS";
@@ -167,6 +185,7 @@ struct OptionEnum : util::Reflection<OptionEnum, Option> {
             case OPT_SID_POWER_SAVE:        return "SID_POWER_SAVE";
             case OPT_SID_ENGINE:            return "SID_ENGINE";
             case OPT_SID_SAMPLING:          return "SID_SAMPLING";
+            case OPT_SID_PARALLEL:          return "SID_PARALLEL";
             case OPT_AUDPAN:                return "AUDPAN";
             case OPT_AUDVOL:                return "AUDVOL";
             case OPT_AUDVOLL:               return "AUDVOLL";
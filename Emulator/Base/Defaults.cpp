@@ -25,6 +25,12 @@ Defaults::Defaults()
     setFallback(OPT_TIME_SLICES, 1);
     setFallback(OPT_AUTO_FPS, true);
     setFallback(OPT_PROPOSED_FPS, 60);
+    setFallback(OPT_DRIVE_SYNC, DRIVE_SYNC_LOCKSTEP);
+    setFallback(OPT_RUN_AHEAD, 0);
+
+    setFallback(OPT_REWIND_HISTORY, 0);
+    setFallback(OPT_REWIND_RATE, 10);
+    setFallback(OPT_REWIND_MEMORY, 64);
 
     setFallback(OPT_POWER_GRID, GRID_STABLE_50HZ);
 
@@ -33,6 +39,8 @@ Defaults::Defaults()
 
     setFallback(OPT_VIC_REVISION, VICII_PAL_8565);
     setFallback(OPT_VIC_POWER_SAVE, true);
+    setFallback(OPT_VIC_HEADLESS, false);
+    setFallback(OPT_VIC_INDEXED, false);
     setFallback(OPT_GRAY_DOT_BUG, true);
     setFallback(OPT_GLUE_LOGIC, GLUE_LOGIC_DISCRETE);
     setFallback(OPT_PALETTE, PALETTE_COLOR);
@@ -66,6 +74,7 @@ Defaults::Defaults()
     setFallback(OPT_SID_FILTER, false);
     setFallback(OPT_SID_ENGINE, SIDENGINE_RESID);
     setFallback(OPT_SID_SAMPLING, SAMPLING_INTERPOLATE);
+    setFallback(OPT_SID_PARALLEL, true);
     setFallback(OPT_AUDVOLL, 50);
     setFallback(OPT_AUDVOLR, 50);
 
@@ -12,48 +12,134 @@
 
 #include "config.h"
 #include "MsgQueue.h"
+#include "C64.h"
 
 namespace vc64 {
 
+void
+MsgQueue::Slot::store(const Message &msg)
+{
+    // Acquire write access by making the sequence counter odd
+    auto s = seq.load(std::memory_order_relaxed) & ~1LL;
+    while (!seq.compare_exchange_weak(s, s + 1, std::memory_order_acquire)) { s &= ~1LL; }
+
+    type.store(msg.type, std::memory_order_relaxed);
+    value.store(msg.value, std::memory_order_relaxed);
+
+    seq.store(s + 2, std::memory_order_release);
+}
+
+Message
+MsgQueue::Slot::load() const
+{
+    while (true) {
+
+        auto s = seq.load(std::memory_order_acquire);
+        if (s & 1) continue;
+
+        auto msg = Message { .type = MsgType(type.load(std::memory_order_relaxed)),
+                             .value = value.load(std::memory_order_relaxed) };
+
+        // Retry if the slot has been modified in the meantime
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq.load(std::memory_order_relaxed) == s) return msg;
+    }
+}
+
+MsgQueue::~MsgQueue()
+{
+    haltDeliverer();
+}
+
+void
+MsgQueue::_dump(Category category, std::ostream& os) const
+{
+    using namespace util;
+
+    if (category == Category::State) {
+
+        os << tab("Listener");
+        os << bol(listener != nullptr) << std::endl;
+        os << tab("Delivery thread");
+        os << bol(delivering.load()) << std::endl;
+        os << tab("Pending messages");
+        os << bol(!queue.isEmpty(), "yes", "no") << std::endl;
+        os << tab("Coalesced messages");
+        os << dec(coalesced.load()) << std::endl;
+        os << tab("Lost messages");
+        os << dec(dropped.load()) << std::endl;
+    }
+}
+
 void
 MsgQueue::setListener(const void *listener, Callback *callback)
 {
-    {   SYNCHRONIZED
+    // Let the old listener process all pending messages
+    haltDeliverer();
 
-        this->listener = listener;
-        this->callback = callback;
+    this->listener = listener;
+    this->callback = callback;
 
-        // Send all pending messages
-        while (!queue.isEmpty()) {
+    // Send all pending messages and the following ones to the new listener
+    if (listener) launchDeliverer();
+}
 
-            Message &msg = queue.read();
-            callback(listener, msg);
-        }        
+isize
+MsgQueue::slotNr(const Message &msg) const
+{
+    switch (msg.type) {
+
+        case MSG_DRIVE_LED_ON:
+        case MSG_DRIVE_LED_OFF:     return 0 + (msg.value & 1);
+        case MSG_DRIVE_MOTOR_ON:
+        case MSG_DRIVE_MOTOR_OFF:   return 2 + (msg.value & 1);
+        case MSG_IEC_BUS_BUSY:
+        case MSG_IEC_BUS_IDLE:      return 4;
+        case MSG_VC1530_COUNTER:    return 5;
+        case MSG_CONSOLE_UPDATE:    return 6;
+
+        default:
+            return -1;
     }
 }
 
 void
 MsgQueue::put(const Message &msg)
 {
-    {   SYNCHRONIZED
+    /* Discard all messages sent from run-ahead frames. These frames are only
+     * emulated by the emulator thread and the drive thread. Messages from
+     * other threads are always delivered.
+     */
+    if ((c64.isEmulatorThread() || c64.isCatchingUp()) && c64.isRunningAhead()) return;
+
+    debug(MSG_DEBUG, "%s [%llx]\n", MsgTypeEnum::key(msg.type), msg.value);
 
-        debug(MSG_DEBUG, "%s [%llx]\n", MsgTypeEnum::key(msg.type), msg.value);
+    if (auto nr = slotNr(msg); nr >= 0) {
 
-        if (listener) {
+        auto &slot = slots[nr];
+        slot.store(msg);
 
-            // Send the message immediately if a lister has been registered
-            callback(listener, msg); return;
+        // Only queue a token if the listener hasn't been notified yet
+        if (slot.pending.exchange(true, std::memory_order_acq_rel)) {
 
-        } else {
+            coalesced++;
+            return;
+        }
+        if (!queue.put(Message { .type = MSG_NONE, .value = nr })) {
 
-            // Otherwise, store it in the ring buffer
-            if (!queue.isFull()) {
-                queue.write(msg);
-            } else {
-                warn("Message lost: %s [%llx]\n", MsgTypeEnum::key(msg.type), msg.value);
-            }
+            slot.pending.store(false, std::memory_order_release);
+            dropped++;
+            return;
         }
+
+    } else if (!queue.put(msg)) {
+
+        warn("Message lost: %s [%llx]\n", MsgTypeEnum::key(msg.type), msg.value);
+        dropped++;
+        return;
     }
+
+    wakeUp();
 }
 
 void
@@ -83,12 +169,70 @@ MsgQueue::put(MsgType type, ScriptMsg payload)
 bool
 MsgQueue::get(Message &msg)
 {
-    {   SYNCHRONIZED
+    if (!queue.get(msg)) return false;
+
+    // Replace tokens by the most recent message of the referenced slot
+    if (msg.type == MSG_NONE) {
+
+        auto &slot = slots[msg.value];
+        slot.pending.exchange(false, std::memory_order_acq_rel);
+        msg = slot.load();
+    }
+    return true;
+}
+
+void
+MsgQueue::wakeUp()
+{
+    if (delivering.load(std::memory_order_relaxed)) {
+
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_one();
+    }
+}
+
+void
+MsgQueue::launchDeliverer()
+{
+    if (!deliverer.joinable()) {
+
+        debug(RUN_DEBUG, "Launching the delivery thread\n");
+
+        delivering = true;
+        deliverer = std::thread(&MsgQueue::runDeliverer, this);
+    }
+}
+
+void
+MsgQueue::haltDeliverer()
+{
+    if (deliverer.joinable()) {
+
+        debug(RUN_DEBUG, "Halting the delivery thread\n");
+
+        delivering = false;
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_one();
+        deliverer.join();
+    }
+}
+
+void
+MsgQueue::runDeliverer()
+{
+    Message msg;
+
+    while (true) {
+
+        // Remember the wake-up signal before checking the queue
+        auto s = signal.load(std::memory_order_acquire);
+
+        while (get(msg)) callback(listener, msg);
 
-        if (queue.isEmpty()) return false;
+        if (!delivering.load(std::memory_order_acquire)) break;
 
-        msg = queue.read();
-        return true;
+        // Sleep until a new message arrives
+        signal.wait(s, std::memory_order_acquire);
     }
 }
 
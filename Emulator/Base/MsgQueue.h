@@ -14,14 +14,54 @@
 
 #include "MsgQueueTypes.h"
 #include "SubComponent.h"
-#include "RingBuffer.h"
+#include "ConcurrentQueue.h"
+#include <thread>
 
 namespace vc64 {
 
+/* The message queue transfers messages from the emulator to the registered
+ * listener. Messages are stored in a lock-free queue, which means that the
+ * sending thread never blocks. If a listener has been registered, a delivery
+ * thread picks up the messages and calls the listener's callback function.
+ * Otherwise, the messages stay in the queue until they are read via get().
+ *
+ * Messages reporting a state change with a high frequency (drive LEDs and
+ * motors, the IEC bus, the datasette counter, console updates) are coalesced.
+ * Each of them is assigned to a slot storing the most recent message. Only
+ * a single token referring to the slot is queued until the listener has
+ * picked it up, so the listener always receives the latest state without
+ * being flooded by intermediate states.
+ */
 class MsgQueue : public SubComponent {
 
-    // Ring buffer storing all pending messages
-    util::RingBuffer <Message, 128> queue;
+    // Capacity of the message queue
+    static constexpr isize capacity = 512;
+
+    // Number of slots for coalesced messages
+    static constexpr isize numSlots = 7;
+
+    // Storage for the most recent message of a coalesced message type
+    struct Slot {
+
+        // Sequence counter (odd while the slot is being written)
+        std::atomic<i64> seq = 0;
+
+        // The stored message
+        std::atomic<i64> type = MSG_NONE;
+        std::atomic<i64> value = 0;
+
+        // Indicates whether a token for this slot is in the queue
+        std::atomic<bool> pending = false;
+
+        void store(const Message &msg);
+        Message load() const;
+    };
+
+    // Queue storing all pending messages
+    util::ConcurrentQueue <Message, capacity> queue;
+
+    // Coalesced messages
+    Slot slots[numSlots];
 
     // The registered listener
     const void *listener = nullptr;
@@ -29,13 +69,29 @@ class MsgQueue : public SubComponent {
     // The registered callback function
     Callback *callback = nullptr;
 
+    // The delivery thread
+    std::thread deliverer;
+
+    // Indicates whether the delivery thread should keep running
+    std::atomic<bool> delivering = false;
+
+    // Incremented whenever the delivery thread needs to wake up
+    std::atomic<i64> signal = 0;
+
+    // Number of lost and coalesced messages
+    std::atomic<i64> dropped = 0;
+    std::atomic<i64> coalesced = 0;
+
     
     //
     // Constructing
     //
     
+public:
+
     using SubComponent::SubComponent;
-    
+    ~MsgQueue();
+
     
     //
     // Methods from CoreObject
@@ -44,7 +100,7 @@ class MsgQueue : public SubComponent {
 private:
 
     const char *getDescription() const override { return "MsgQueue"; }
-    void _dump(Category category, std::ostream& os) const override { }
+    void _dump(Category category, std::ostream& os) const override;
 
 
     //
@@ -78,6 +134,19 @@ public:
 
     // Reads a message
     bool get(Message &msg);
+
+private:
+
+    // Returns the slot of a coalesced message or -1 if it isn't coalesced
+    isize slotNr(const Message &msg) const;
+
+    // Wakes up the delivery thread
+    void wakeUp();
+
+    // Manages the delivery thread
+    void launchDeliverer();
+    void haltDeliverer();
+    void runDeliverer();
 };
 
 }
@@ -115,6 +115,10 @@ enum_long(MSG_TYPE)
     MSG_RECORDING_STOPPED,
     MSG_RECORDING_ABORTED,
 
+    // Input movies
+    MSG_MOVIE_RECORD,
+    MSG_MOVIE_REPLAY,
+
     // Debugging
     MSG_DMA_DEBUG,
 
@@ -213,6 +217,8 @@ struct MsgTypeEnum : util::Reflection<MsgType, MsgType> {
             case MSG_RECORDING_STARTED:     return "RECORDING_STARTED";
             case MSG_RECORDING_STOPPED:     return "RECORDING_STOPPED";
             case MSG_RECORDING_ABORTED:     return "RECORDING_ABORTED";
+            case MSG_MOVIE_RECORD:          return "MOVIE_RECORD";
+            case MSG_MOVIE_REPLAY:          return "MOVIE_REPLAY";
 
             case MSG_DMA_DEBUG:             return "DMA_DEBUG";
 
@@ -36,6 +36,7 @@ msgQueue(ref.msgQueue),
 oscillator(ref.supply),
 parCable(ref.parCable),
 recorder(ref.recorder),
+inputRecorder(ref.inputRecorder),
 regressionTester(ref.regressionTester),
 retroShell(ref.retroShell),
 muxer(ref.muxer),
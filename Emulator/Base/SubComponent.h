@@ -41,6 +41,7 @@ class MsgQueue;
 class PowerSupply;
 class ParCable;
 class Recorder;
+class InputRecorder;
 class RegressionTester;
 class RetroShell;
 class AnyFile;
@@ -80,6 +81,7 @@ protected:
     PowerSupply &oscillator;
     ParCable &parCable;
     Recorder &recorder;
+    InputRecorder &inputRecorder;
     RegressionTester &regressionTester;
     RetroShell &retroShell;
     Muxer &muxer;
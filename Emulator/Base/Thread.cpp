@@ -12,11 +12,14 @@
 
 #include "config.h"
 #include "Thread.h"
+#include "ThreadPool.h"
 #include "Chrono.h"
 #include <iostream>
 
 namespace vc64 {
 
+thread_local Thread *Thread::current = nullptr;
+
 Thread::Thread()
 {
 
@@ -196,27 +199,75 @@ Thread::main()
         }
         
         // Are we requested to change state?
-        if (stateChangeRequest.test()) {
+        processStateChangeRequest();
+        if (state == EXEC_HALTED) return;
 
-            switchState(newState);
-            stateChangeRequest.clear();
-            stateChangeRequest.notify_one();
+        // Compute the CPU load once in a while
+        updateCpuLoad();
+    }
+}
 
-            if (state == EXEC_HALTED) return;
-        }
+util::Time
+Thread::poolExecute()
+{
+    auto now = util::Time::now();
 
-        // Compute the CPU load once in a while
-        if (sliceCounter % (32 * slicesPerFrame()) == 0) {
+    if (isRunning()) {
 
-            auto used  = loadClock.getElapsedTime().asSeconds();
-            auto total = nonstopClock.getElapsedTime().asSeconds();
+        if (!warp && now >= targetTime) {
 
-            cpuLoad = used / total;
+            // Make sure the emulator is still in sync
+            if ((now - targetTime).asMilliseconds() > 200) {
+                warn("Emulation is way too slow: %f sec behind\n", (now - targetTime).asSeconds());
+                resync();
+            }
 
-            loadClock.restart();
-            loadClock.stop();
-            nonstopClock.restart();
+            // Compute the next time slice
+            targetTime += sliceDuration();
+            missing = 1;
         }
+
+        execute<SYNC_PERIODIC>();
+
+    } else {
+
+        // Keep the timer in sync while the emulator is not running
+        targetTime = now + sliceDuration();
+    }
+
+    // Are we requested to change state?
+    processStateChangeRequest();
+
+    // Compute the CPU load once in a while
+    updateCpuLoad();
+
+    return isRunning() && warp ? now : targetTime;
+}
+
+void
+Thread::processStateChangeRequest()
+{
+    if (stateChangeRequest.test()) {
+
+        switchState(newState);
+        stateChangeRequest.clear();
+        stateChangeRequest.notify_one();
+    }
+}
+
+void
+Thread::updateCpuLoad()
+{
+    if (sliceCounter % (32 * slicesPerFrame()) == 0) {
+
+        auto used  = loadClock.getElapsedTime().asSeconds();
+        auto total = nonstopClock.getElapsedTime().asSeconds();
+
+        cpuLoad = used / total;
+
+        loadClock.restart();
+        loadClock.stop();
+        nonstopClock.restart();
     }
 }
 
@@ -383,6 +434,13 @@ Thread::halt()
     join();
 }
 
+void
+Thread::join()
+{
+    if (thread.joinable()) thread.join();
+    if (pool) { pool->detach(*this); pool = nullptr; }
+}
+
 void
 Thread::warpOn(isize source)
 {
@@ -420,6 +478,9 @@ Thread::changeStateTo(ExecutionState requestedState)
     stateChangeRequest.test_and_set();
     assert(stateChangeRequest.test() == true);
 
+    // In pool mode, make sure the request is processed without delay
+    if (pool) pool->wakeUp(*this);
+
     // Wait until the change has been performed
     stateChangeRequest.wait(true);
     assert(stateChangeRequest.test() == false);
@@ -166,16 +166,43 @@ namespace vc64 {
  * closed. In track mode, several time-consuming tasks are performed that are
  * usually left out. E.g., the CPU tracks all executed instructions and stores
  * the recorded information in a trace buffer.
+ *
+ * 6. Pool mode:
+ *
+ * Instead of running in a thread of its own, an instance can be attached to a
+ * ThreadPool. In this mode, no dedicated thread is created. Instead, the pool
+ * workers call poolExecute() which runs a single iteration of the run loop
+ * without blocking. Pacing is always periodic in this mode, i.e., the pool
+ * reschedules each instance at the beginning of the next time slice, unless
+ * the instance runs in warp mode. Pooled instances never spawn helper threads.
+ * Threaded drive synchronization falls back to catch-up mode, parallel SID
+ * synthesis is disabled, and messages are read via MsgQueue::get() instead of
+ * being delivered by a thread of their own.
  */
 
+class ThreadPool;
+
 class Thread : public CoreComponent, util::Wakeable {
     
 protected:
 
     friend class C64;
+    friend class ThreadPool;
     
     // The thread object
     std::thread thread;
+
+    // The thread pool executing this instance (pool mode only)
+    ThreadPool *pool = nullptr;
+
+    // Set while a pool worker executes this instance (pool mode only)
+    std::atomic<bool> claimed = false;
+
+    // Identifies the most recent pool queue entry (pool mode only)
+    std::atomic<u64> ticket = 0;
+
+    // The instance executed by the calling pool worker (pool mode only)
+    static thread_local Thread *current;
     
     // The current thread state and a change request
     ExecutionState state = EXEC_OFF;
@@ -261,10 +288,24 @@ private:
     // The main entry point (called when the thread is created)
     void main();
 
+    // Executes a single run loop iteration and returns the next due time
+    util::Time poolExecute();
+
+    // Performs a pending state change
+    void processStateChangeRequest();
+
+    // Updates the CPU load once in a while
+    void updateCpuLoad();
+
 public:
 
+    // Returns true if this instance is executed by a thread pool
+    bool isPooled() const { return pool != nullptr; }
+
     // Returns true if this functions is called from within the emulator thread
-    bool isEmulatorThread() { return std::this_thread::get_id() == thread.get_id(); }
+    bool isEmulatorThread() {
+        return pool ? current == this : std::this_thread::get_id() == thread.get_id();
+    }
     
     // Performs a state change
     void switchState(ExecutionState newState);
@@ -332,7 +373,7 @@ public:
 private:
     
     // Wait until the thread has terminated
-    void join() { if (thread.joinable()) thread.join(); }
+    void join();
 };
 
 struct AutoResume {
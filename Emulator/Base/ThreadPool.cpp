@@ -0,0 +1,225 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace vc64 {
+
+ThreadPool::ThreadPool(isize count)
+{
+    if (count <= 0) count = std::max(1U, std::thread::hardware_concurrency());
+
+    for (isize i = 0; i < count; i++) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (isize i = 0; i < count; i++) {
+        workers[i]->thread = std::thread(&ThreadPool::main, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {   std::lock_guard<std::mutex> lock(timerMutex);
+        terminating = true;
+    }
+    timerCond.notify_all();
+
+    for (auto &worker : workers) {
+        if (worker->thread.joinable()) worker->thread.join();
+    }
+}
+
+void
+ThreadPool::attach(Thread &thread)
+{
+    assert(thread.pool == nullptr);
+    assert(!thread.thread.joinable());
+
+    thread.pool = this;
+    thread.baseTime = util::Time::now();
+    thread.targetTime = util::Time::now();
+
+    wakeUp(thread);
+}
+
+void
+ThreadPool::detach(Thread &thread)
+{
+    assert(thread.pool == this);
+    assert(thread.isHalted());
+
+    // Remove all queue entries referring to this instance
+    {   std::lock_guard<std::mutex> lock(timerMutex);
+
+        std::erase_if(timers, [&](const Entry &e) { return e.thread == &thread; });
+        std::make_heap(timers.begin(), timers.end(), std::greater<Entry>());
+
+        for (auto &worker : workers) {
+
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            std::erase_if(worker->ready, [&](const Entry &e) { return e.thread == &thread; });
+        }
+    }
+
+    // Wait until no worker is executing this instance any more
+    std::unique_lock<std::mutex> lock(claimMutex);
+    claimCond.wait(lock, [&]{ return !thread.claimed; });
+}
+
+void
+ThreadPool::wakeUp(Thread &thread)
+{
+    schedule(thread, util::Time::now(), next++ % workerCount());
+}
+
+void
+ThreadPool::schedule(Thread &thread, util::Time due, isize nr)
+{
+    // Invalidate all older queue entries of this instance
+    auto ticket = ++thread.ticket;
+
+    // Don't delay pending state change requests
+    if (thread.stateChangeRequest.test()) due = util::Time::now();
+
+    if (due <= util::Time::now()) {
+
+        {   std::lock_guard<std::mutex> lock(workers[nr]->mutex);
+
+            if (thread.isHalted()) return;
+            workers[nr]->ready.push_back(Entry { due, &thread, ticket });
+        }
+        timerCond.notify_one();
+
+    } else {
+
+        {   std::lock_guard<std::mutex> lock(timerMutex);
+
+            if (thread.isHalted()) return;
+            timers.push_back(Entry { due, &thread, ticket });
+            std::push_heap(timers.begin(), timers.end(), std::greater<Entry>());
+        }
+        timerCond.notify_one();
+    }
+}
+
+void
+ThreadPool::expireTimers(isize nr)
+{
+    auto now = util::Time::now();
+
+    std::lock_guard<std::mutex> lock(timerMutex);
+    if (timers.empty() || timers.front().due > now) return;
+
+    std::lock_guard<std::mutex> lock2(workers[nr]->mutex);
+    while (!timers.empty() && timers.front().due <= now) {
+
+        std::pop_heap(timers.begin(), timers.end(), std::greater<Entry>());
+        workers[nr]->ready.push_back(timers.back());
+        timers.pop_back();
+    }
+}
+
+bool
+ThreadPool::claim(std::deque<Entry> &queue, Entry &entry, bool front)
+{
+    // Called with the queue's mutex locked
+    while (!queue.empty()) {
+
+        if (front) {
+            entry = queue.front(); queue.pop_front();
+        } else {
+            entry = queue.back(); queue.pop_back();
+        }
+
+        // Skip stale entries
+        if (entry.ticket != entry.thread->ticket || entry.thread->isHalted()) continue;
+
+        // Claim the instance
+        bool expected = false;
+        if (entry.thread->claimed.compare_exchange_strong(expected, true)) return true;
+
+        // The instance is still executed by another worker. Retry later.
+        queue.push_back(entry);
+        return false;
+    }
+    return false;
+}
+
+bool
+ThreadPool::dequeue(isize nr, Entry &entry)
+{
+    expireTimers(nr);
+
+    // Try the own queue first
+    {   std::lock_guard<std::mutex> lock(workers[nr]->mutex);
+        if (claim(workers[nr]->ready, entry, true)) return true;
+    }
+
+    // Steal work from the other workers
+    auto count = workerCount();
+    for (isize i = 1; i < count; i++) {
+
+        auto &victim = *workers[(nr + i) % count];
+
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (claim(victim.ready, entry, false)) return true;
+    }
+
+    return false;
+}
+
+void
+ThreadPool::release(Thread &thread)
+{
+    {   std::lock_guard<std::mutex> lock(claimMutex);
+        thread.claimed = false;
+    }
+    claimCond.notify_all();
+}
+
+void
+ThreadPool::main(isize nr)
+{
+    while (!terminating) {
+
+        Entry entry;
+
+        if (dequeue(nr, entry)) {
+
+            auto &thread = *entry.thread;
+
+            // Execute a single time slice
+            Thread::current = &thread;
+            auto due = thread.poolExecute();
+            Thread::current = nullptr;
+
+            // Put the instance back into a queue
+            if (!thread.isHalted()) schedule(thread, due, nr);
+            release(thread);
+            continue;
+        }
+
+        // Sleep until the next timer expires or new work arrives
+        std::unique_lock<std::mutex> lock(timerMutex);
+        if (terminating) break;
+
+        auto timeout = util::Time::now() + util::Time::milliseconds(10);
+        auto wakeup = timers.empty() ? timeout : std::min(timers.front().due, timeout);
+        auto delay = std::chrono::nanoseconds((wakeup - util::Time::now()).asNanoseconds());
+
+        if (delay.count() > 0) timerCond.wait_for(lock, delay);
+    }
+}
+
+}
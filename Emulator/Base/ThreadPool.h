@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Thread.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vc64 {
+
+/* This class provides an alternative execution model for emulator instances.
+ * By default, each instance runs in a thread of its own (see class Thread).
+ * This works well for a single emulator, but it doesn't scale if hundreds of
+ * headless instances are run side by side. In this case, the instances can be
+ * attached to a thread pool which executes them on a fixed set of workers.
+ *
+ * A worker executes one time slice of an instance at a time (see
+ * Thread::poolExecute()). Afterwards, the instance is put back into one of the
+ * queues. Instances in warp mode are due immediately and end up in the
+ * ready queue of the worker that executed them. All other instances are put
+ * into a timer queue which preserves the pacing of each instance. Once a
+ * timer expires, the instance is moved into the ready queue of the worker
+ * that spotted it. Idle workers steal instances from the other ready queues.
+ *
+ * Each queue entry carries a ticket number. Whenever an instance is put into
+ * a queue, it receives a new ticket and all older entries become stale. This
+ * guarantees that a single valid entry exists per instance at any time.
+ */
+class ThreadPool {
+
+    struct Entry {
+
+        // Time at which the instance needs to run again
+        util::Time due;
+
+        // The emulator instance
+        Thread *thread;
+
+        // Identifies the most recent queue entry of this instance
+        u64 ticket;
+
+        bool operator>(const Entry &rhs) const { return due > rhs.due; }
+    };
+
+    struct Worker {
+
+        // The worker thread
+        std::thread thread;
+
+        // Instances ready for execution
+        std::deque<Entry> ready;
+        std::mutex mutex;
+    };
+
+    // The worker threads
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Instances waiting for their next time slice (min-heap on 'due')
+    std::vector<Entry> timers;
+    std::mutex timerMutex;
+    std::condition_variable timerCond;
+
+    // Used to wait until a worker has released an instance
+    std::mutex claimMutex;
+    std::condition_variable claimCond;
+
+    // Worker that receives the next externally scheduled instance
+    std::atomic<isize> next = 0;
+
+    // Set to true when the pool is destroyed
+    std::atomic<bool> terminating = false;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    // Creates a pool with the specified number of workers (0 = one per core)
+    ThreadPool(isize count = 0);
+    ~ThreadPool();
+
+    // Returns the number of worker threads
+    isize workerCount() const { return isize(workers.size()); }
+
+
+    //
+    // Managing instances
+    //
+
+public:
+
+    // Adds an instance to the pool
+    void attach(Thread &thread);
+
+    // Removes an instance from the pool
+    void detach(Thread &thread);
+
+    // Requests an instance to be executed as soon as possible
+    void wakeUp(Thread &thread);
+
+
+    //
+    // Running the workers
+    //
+
+private:
+
+    // The main entry point of a worker thread
+    void main(isize nr);
+
+    // Puts an instance into the appropriate queue
+    void schedule(Thread &thread, util::Time due, isize nr);
+
+    // Picks the next instance to execute
+    bool dequeue(isize nr, Entry &entry);
+
+    // Moves all instances with an expired timer into a ready queue
+    void expireTimers(isize nr);
+
+    // Checks if an entry is valid and claims the instance if possible
+    bool claim(std::deque<Entry> &queue, Entry &entry, bool front);
+
+    // Releases a claimed instance
+    void release(Thread &thread);
+};
+
+}
@@ -0,0 +1,834 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "Benchmark.h"
+#include "C64.h"
+#include "Chrono.h"
+#include "IOUtils.h"
+#include <algorithm>
+#include <iostream>
+#include <random>
+
+int main(int argc, char *argv[])
+{
+    try {
+
+        vc64::C64 c64;
+        std::vector<string> names;
+
+        // Install all ROM images and collect the names of all benchmarks
+        for (int i = 1; i < argc; i++) {
+
+            if (util::fileExists(argv[i])) {
+                c64.loadRom(argv[i]);
+            } else {
+                names.push_back(argv[i]);
+            }
+        }
+
+        return vc64::Benchmark(std::cout).run(c64, names);
+
+    } catch (vc64::VC64Error &e) {
+
+        std::cout << "VC64Error: " << std::endl;
+        std::cout << e.what() << std::endl;
+        return 1;
+
+    } catch (std::exception &e) {
+
+        std::cout << "Error: " << std::endl;
+        std::cout << e.what() << std::endl;
+        return 1;
+    }
+}
+
+namespace vc64 {
+
+int
+Benchmark::run(C64 &c64, const std::vector<string> &names)
+{
+    const std::vector<std::pair<string, void (Benchmark::*)(C64 &)>> benchmarks = {
+
+        { "snapshot",   &Benchmark::snapshot },
+        { "audio",      &Benchmark::audio },
+        { "resample",   &Benchmark::resample },
+        { "canvas",     &Benchmark::canvas },
+        { "cpu",        &Benchmark::cpu },
+        { "memory",     &Benchmark::memory },
+        { "guards",     &Benchmark::guards },
+        { "events",     &Benchmark::events }
+    };
+
+    // Check the arguments
+    for (auto &name : names) {
+
+        auto matches = [&](auto &benchmark) { return benchmark.first == name; };
+        if (std::none_of(benchmarks.begin(), benchmarks.end(), matches)) {
+
+            os << "Usage: vc64Bench [<rom>...] [<benchmark>...]" << std::endl;
+            os << std::endl;
+            os << "       Benchmarks:";
+            for (auto &benchmark : benchmarks) os << " " << benchmark.first;
+            os << std::endl;
+            return 1;
+        }
+    }
+
+    // Run the benchmarks
+    for (auto &benchmark : benchmarks) {
+
+        if (names.empty() || std::find(names.begin(), names.end(), benchmark.first) != names.end()) {
+
+            os << benchmark.first << ":" << std::endl;
+            (this->*benchmark.second)(c64);
+            os << std::endl;
+        }
+    }
+
+    return 0;
+}
+
+i64
+Benchmark::measure(std::function<void()> func, isize runs)
+{
+    i64 best = INT64_MAX;
+
+    for (isize i = 0; i < runs; i++) {
+
+        auto start = util::Time::now().asNanoseconds();
+        func();
+        best = std::min(best, util::Time::now().asNanoseconds() - start);
+    }
+    return std::max(best, i64(1));
+}
+
+void
+Benchmark::report(const string &name, i64 ops, i64 refNanos, i64 nanos)
+{
+    using namespace util;
+
+    os << tab(name);
+    os << flt(double(refNanos) / ops) << " ns -> ";
+    os << flt(double(nanos) / ops) << " ns per op  (";
+    os << flt(double(refNanos) / nanos) << "x)" << std::endl;
+}
+
+void
+Benchmark::report(const string &name, i64 nanos)
+{
+    using namespace util;
+
+    os << tab(name);
+    os << flt(double(nanos) / 1000.0) << " us" << std::endl;
+}
+
+
+//
+// Snapshot serializer
+//
+
+void
+Benchmark::snapshot(C64 &c64)
+{
+    using namespace util;
+
+    // A memory image of the size of the C64 RAM
+    static u8 image[0x10000];
+    Buffer<u8> buffer(isize(sizeof(image)));
+
+    // The reference model processes the image byte by byte
+    auto refWrite = measure([&]() {
+        SerWriter writer(buffer.ptr); for (auto &it : image) writer << it; });
+    auto optWrite = measure([&]() {
+        SerWriter writer(buffer.ptr); writer << image; });
+    auto refRead = measure([&]() {
+        SerReader reader(buffer.ptr); for (auto &it : image) reader << it; });
+    auto optRead = measure([&]() {
+        SerReader reader(buffer.ptr); reader << image; });
+
+    report("Serializer (write)", sizeof(image), refWrite, optWrite);
+    report("Serializer (read)", sizeof(image), refRead, optRead);
+
+    // Measure the round trip of the complete emulator state
+    {   AutoResume _ar(&c64);
+
+        Buffer<u8> state(c64.size());
+
+        // The reference model computes the checksum in a separate pass
+        auto refSave = measure([&]() { c64.saveUnchecked(state.ptr); c64.checksum(); });
+        auto save = measure([&]() { c64.save(state.ptr); });
+        auto refLoad = measure([&]() { c64.loadUnchecked(state.ptr); c64.didLoad(); c64.checksum(); });
+        auto load = measure([&]() { c64.load(state.ptr); });
+
+        report("C64::save", 1, refSave, save);
+        report("C64::load", 1, refLoad, load);
+
+        // Measure the snapshot compressor
+        Snapshot snapshot(c64);
+        auto rawSize = snapshot.size;
+
+        isize packedSize = 0;
+        i64 compress = INT64_MAX, uncompress = INT64_MAX;
+
+        for (isize i = 0; i < 5; i++) {
+
+            auto t0 = Time::now().asNanoseconds();
+            snapshot.compress();
+            auto t1 = Time::now().asNanoseconds();
+            packedSize = snapshot.size;
+            snapshot.uncompress();
+            auto t2 = Time::now().asNanoseconds();
+
+            compress = std::min(compress, t1 - t0);
+            uncompress = std::min(uncompress, t2 - t1);
+        }
+
+        report("Snapshot::compress", compress);
+        report("Snapshot::uncompress", uncompress);
+
+        os << tab("Snapshot size");
+        os << dec(rawSize / 1024) << " KB -> " << dec(packedSize / 1024) << " KB" << std::endl;
+    }
+}
+
+
+//
+// Audio pipeline
+//
+
+/* The reference model of the mixer processes the SID streams sample by sample
+ * as Muxer::mixMultiSID() did before the block-based kernels were introduced.
+ */
+static void
+refMix(SampleStream *in, StereoStream &out, isize n, float *vol, float *pan, float vl, float vr)
+{
+    for (isize i = 0; i < n; i++) {
+
+        float ch0 = (float)in[0].read()  * vol[0];
+        float ch1 = (float)in[1].read(0) * vol[1];
+        float ch2 = (float)in[2].read(0) * vol[2];
+        float ch3 = (float)in[3].read(0) * vol[3];
+
+        float l =
+        ch0 * (1 - pan[0]) + ch1 * (1 - pan[1]) +
+        ch2 * (1 - pan[2]) + ch3 * (1 - pan[3]);
+
+        float r =
+        ch0 * pan[0] + ch1 * pan[1] +
+        ch2 * pan[2] + ch3 * pan[3];
+
+        out.write(SamplePair { l * vl, r * vr });
+    }
+}
+
+static void
+refCopy(StereoStream &in, float *left, float *right, isize n, Volume &volL, Volume &volR)
+{
+    for (isize i = 0; i < n; i++) {
+
+        SamplePair pair = in.read();
+        *left++ = pair.left * volL.current;
+        *right++ = pair.right * volR.current;
+    }
+}
+
+void
+Benchmark::audio(C64 &c64)
+{
+    constexpr isize samples = 1024;
+    constexpr isize rounds = 200;
+
+    {   AutoResume _ar(&c64);
+
+        auto &muxer = c64.muxer;
+        Volume volume;
+        float left[samples], right[samples];
+
+        // Fill all SID streams with a test signal
+        SampleStream in[4];
+        muxer.stream.clear();
+        for (isize i = 0; i < 4; i++) {
+
+            muxer.sidStream[i].clear();
+            for (isize j = 0; j < samples; j++) {
+
+                auto sample = short((j * (i + 3) * 97) % 8000 - 4000);
+                muxer.sidStream[i].write(sample);
+                in[i].write(sample);
+            }
+        }
+
+        // Rewinds the read pointers of the SID streams
+        auto rewind = [&](SampleStream *streams) {
+            for (isize i = 0; i < 4; i++) { streams[i].r = 0; streams[i].w = samples; }
+        };
+
+        StereoStream out;
+        auto ref = measure([&]() {
+
+            for (isize i = 0; i < rounds; i++) {
+
+                rewind(in);
+                refMix(in, out, samples, muxer.vol, muxer.pan, muxer.volL.current, muxer.volR.current);
+                refCopy(out, left, right, samples, volume, volume);
+            }
+        });
+        auto opt = measure([&]() {
+
+            for (isize i = 0; i < rounds; i++) {
+
+                rewind(muxer.sidStream);
+                muxer.mixMultiSID(samples);
+                muxer.stream.copyStereo(left, right, samples, volume, volume);
+            }
+        });
+
+        report("Audio mixer (4 SIDs)", samples * rounds, ref, opt);
+
+        muxer.clearSampleBuffers();
+        muxer.clear();
+    }
+}
+
+
+//
+// Resampler
+//
+
+/* Checks the convolution kernels of the reSID resampler against the scalar
+ * reference. The kernels are fed with random data and with extreme values for
+ * all filter lengths up to 128, which covers every tail length of the SIMD
+ * loops. Afterwards, each kernel convolves a sample ring with the FIR table
+ * reSID computes for a 44.1 kHz output.
+ */
+void
+Benchmark::resample(C64 &c64)
+{
+    constexpr int maxTaps = 128;
+    constexpr isize calls = 100000;
+
+    auto kernels = reSID::SID::convolve_kernels();
+    auto scalar = kernels[0].func;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> random(-32768, 32767);
+    std::vector<short> a(maxTaps), b(maxTaps);
+    bool identical = true;
+
+    auto verify = [&]() {
+
+        for (int n = 0; n <= maxTaps; n++) {
+
+            auto expected = scalar(a.data(), b.data(), n);
+            for (auto k = kernels + 1; k->name; k++) {
+                identical &= k->func(a.data(), b.data(), n) == expected;
+            }
+        }
+    };
+
+    // Random data
+    for (isize round = 0; round < 16; round++) {
+
+        for (auto &it : a) it = short(random(rng));
+        for (auto &it : b) it = short(random(rng));
+        verify();
+    }
+
+    // Extreme values
+    for (short x : { -32768, 32767 }) {
+        for (short y : { -32768, 32767 }) {
+
+            std::fill(a.begin(), a.end(), x);
+            std::fill(b.begin(), b.end(), y);
+            verify();
+        }
+    }
+    for (isize round = 0; round < 16; round++) {
+
+        for (auto &it : a) it = random(rng) & 1 ? 32767 : -32768;
+        for (auto &it : b) it = random(rng) & 1 ? 32767 : -32768;
+        verify();
+    }
+
+    // Setup the FIR table and a sample ring with random music
+    auto sid = std::make_unique<reSID::SID>();
+    sid->set_sampling_parameters(PAL_CLOCK_FREQUENCY, reSID::SAMPLE_RESAMPLE, 44100);
+    auto taps = sid->fir_N;
+    auto fir = sid->fir;
+    auto rows = sid->fir_RES;
+
+    std::vector<short> ring(taps + calls);
+    for (auto &it : ring) it = short(random(rng) / 4);
+    volatile int sink = 0;
+
+    auto run = [&](reSID::convolve_func func) {
+
+        int sum = 0;
+        for (isize i = 0; i < calls; i++) {
+            sum += func(ring.data() + i, fir + (i % rows) * taps, taps);
+        }
+        sink = sum;
+    };
+
+    os << util::tab("Filter length") << taps << " taps" << std::endl;
+
+    auto ref = measure([&]() { run(scalar); });
+    for (auto k = kernels; k->name; k++) {
+
+        auto opt = measure([&]() { run(k->func); });
+        report(string(k->name) + (k->selected ? " (selected)" : ""), calls, ref, opt);
+    }
+
+    os << util::tab("Output");
+    os << (identical ? "Identical" : "MISMATCH") << std::endl;
+
+    (void)sink;
+}
+
+
+//
+// Canvas renderer
+//
+
+/* Draws the canvas area of a number of frames in all valid display modes. The
+ * reference model is the pixel-wise sequencer that was used on the fast path
+ * before the shift register bytes were expanded as a whole. Both renderers
+ * are fed with the same g-access pattern and must produce the same texture
+ * and depth values.
+ */
+void
+Benchmark::canvas(C64 &c64)
+{
+    constexpr isize lines = 200;
+    constexpr isize columns = 40;
+    constexpr isize frames = 10;
+
+    static const DisplayMode modes[] = {
+
+        DISPLAY_MODE_STANDARD_TEXT,
+        DISPLAY_MODE_MULTICOLOR_TEXT,
+        DISPLAY_MODE_STANDARD_BITMAP,
+        DISPLAY_MODE_MULTICOLOR_BITMAP,
+        DISPLAY_MODE_EXTENDED_BG_COLOR
+    };
+
+    {   AutoResume _ar(&c64);
+
+        auto &vic = c64.vic;
+
+        // Save all parts of the VICII state that are modified
+        auto sr = vic.sr;
+        auto reg = vic.reg;
+        auto flipflops = vic.flipflops;
+        auto gAccessResult = vic.gAccessResult;
+        auto bufferoffset = vic.bufferoffset;
+        auto emuTexturePtr = vic.emuTexturePtr;
+        u8 zBuffer[TEX_WIDTH];
+        std::memcpy(zBuffer, vic.zBuffer, sizeof(zBuffer));
+
+        // Draw into a scratch line to keep the emulator texture untouched
+        u32 line[TEX_WIDTH] = { };
+        vic.emuTexturePtr = line;
+
+        // Draws all canvas bytes of a frame and returns a hash of the output
+        auto draw = [&](bool reference, bool verify) {
+
+            u64 hash = 0;
+
+            for (isize y = 0; y < lines; y++) {
+
+                for (isize x = 0; x < columns; x++) {
+
+                    auto data = u8((x * 37 + y * 11) ^ (y >> 3) * 0x55);
+                    auto col = u8((x + y / 8) & 0xF);
+                    auto chr = u8(x * 7 + y / 8 * 40);
+
+                    vic.gAccessResult.reset(LO_LO_HI(data, col, chr));
+                    vic.sr.canLoad = true;
+                    vic.bufferoffset = short(x * 8);
+
+                    if (reference) {
+                        vic.drawCanvasPixels<0>();
+                    } else {
+                        vic.drawCanvasFastPath<0>();
+                    }
+                }
+
+                if (verify) {
+
+                    hash = util::fnvIt64(hash, util::fnv64((u8 *)line, sizeof(line)));
+                    hash = util::fnvIt64(hash, util::fnv64(vic.zBuffer, sizeof(vic.zBuffer)));
+                    hash = util::fnvIt64(hash, vic.sr.colorbits);
+                }
+            }
+            return hash;
+        };
+
+        bool identical = true;
+
+        for (auto mode : modes) {
+
+            vic.reg.delayed.mode = mode;
+            vic.reg.delayed.xscroll = 0;
+            vic.flipflops.delayed.vertical = false;
+            for (isize i = 0; i < 4; i++) vic.reg.delayed.colors[COLREG_BG0 + i] = u8(i + 2);
+
+            identical &= draw(true, true) == draw(false, true);
+
+            auto ref = measure([&]() { for (isize i = 0; i < frames; i++) draw(true, false); });
+            auto opt = measure([&]() { for (isize i = 0; i < frames; i++) draw(false, false); });
+
+            report(DisplayModeEnum::key(mode), frames * lines * columns, ref, opt);
+        }
+
+        os << util::tab("Output");
+        os << (identical ? "Identical" : "MISMATCH") << std::endl;
+
+        // Restore the VICII state
+        vic.sr = sr;
+        vic.reg = reg;
+        vic.flipflops = flipflops;
+        vic.gAccessResult = gAccessResult;
+        vic.bufferoffset = bufferoffset;
+        vic.emuTexturePtr = emuTexturePtr;
+        std::memcpy(vic.zBuffer, zBuffer, sizeof(zBuffer));
+    }
+}
+
+
+//
+// CPU instruction dispatch
+//
+
+/* Runs a sequence of identical instructions on the C64 CPU. The reference
+ * model is the switch-based dispatcher, which is compared with the threaded
+ * dispatcher. The benchmark is skipped if the compiler lacks computed gotos.
+ * Only the CPU is clocked. All other components are frozen while the
+ * benchmark runs.
+ */
+void
+Benchmark::cpu(C64 &c64)
+{
+#if !PEDDLE_HAS_THREADED_DISPATCH
+
+    os << "The threaded dispatcher requires computed gotos" << std::endl;
+
+#else
+
+    using namespace util;
+
+    constexpr u16 code = 0xC000;
+    constexpr u16 data = 0x2000;
+    constexpr isize cycles = 1000000;
+
+    struct Instruction { const char *name; std::vector<u8> bytes; };
+
+    static const Instruction instructions[] = {
+
+        { "NOP",            { 0xEA } },
+        { "LDA #imm",       { 0xA9, 0x42 } },
+        { "LDA abs",        { 0xAD, LO_BYTE(data), HI_BYTE(data) } },
+        { "STA abs,X",      { 0x9D, LO_BYTE(data), HI_BYTE(data) } },
+        { "ADC zpg",        { 0x65, 0x80 } },
+        { "INC abs",        { 0xEE, LO_BYTE(data), HI_BYTE(data) } },
+        { "LDA (ind),Y",    { 0xB1, 0x80 } },
+        { "BCC rel",        { 0x90, 0x00 } },
+        { "PHA / PLA",      { 0x48, 0x68 } }
+    };
+
+    {   AutoResume _ar(&c64);
+
+        auto &cpu = c64.cpu;
+        auto &mem = c64.mem;
+
+        // Save the emulator state
+        Buffer<u8> state(c64.size());
+        c64.save(state.ptr);
+
+        // Let the indirect addressing modes point to the data area
+        mem.poke(0x80, LO_BYTE(data));
+        mem.poke(0x81, HI_BYTE(data));
+
+        for (auto &instr : instructions) {
+
+            // Fill the code area with the instruction and jump back
+            u16 addr = code;
+            while (addr < code + 0x0F00) {
+                for (auto byte : instr.bytes) mem.poke(addr++, byte);
+            }
+            mem.poke(addr++, 0x4C);
+            mem.poke(addr++, LO_BYTE(code));
+            mem.poke(addr++, HI_BYTE(code));
+
+            auto run = [&]<bool threaded>() {
+
+                cpu.jump(code);
+                cpu.setI(1);
+                cpu.setC(0);
+                cpu.setRDY(true);
+
+                for (isize i = 0; i < cycles; i++) {
+
+                    cpu.clock++;
+                    cpu.execute<MOS_6510, threaded>();
+                }
+            };
+
+            auto ref = measure([&]() { run.template operator()<false>(); });
+            auto opt = measure([&]() { run.template operator()<true>(); });
+
+            report(instr.name, cycles, ref, opt);
+        }
+
+        // Restore the emulator state
+        c64.load(state.ptr);
+    }
+
+#endif
+}
+
+
+//
+// Memory
+//
+
+/* Reads and writes the plain RAM and ROM areas of the C64 and the first drive.
+ * The reference model resolves each access via the memory type lookup tables,
+ * which is compared with the page pointer tables. The drive ROM is skipped if
+ * no ROM is installed, because its pages are unmapped in this case.
+ */
+void
+Benchmark::memory(C64 &c64)
+{
+    using namespace util;
+
+    constexpr isize rounds = 64;
+
+    {   AutoResume _ar(&c64);
+
+        auto &mem = c64.mem;
+        auto &drv = c64.drive8.mem;
+        volatile u8 sink = 0;
+
+        // Save the emulator state
+        Buffer<u8> state(c64.size());
+        c64.save(state.ptr);
+
+        auto run = [&](u16 first, u16 last, auto access) {
+
+            u8 sum = 0;
+            for (isize i = 0; i < rounds; i++) {
+                for (isize addr = first; addr <= last; addr++) sum += access(u16(addr));
+            }
+            sink = sum;
+        };
+
+        auto c64Peek = [&](u16 first, u16 last, const char *name) {
+
+            auto ref = measure([&]() { run(first, last, [&](u16 a) { return mem.peek(a, mem.getPeekSource(a)); }); });
+            auto opt = measure([&]() { run(first, last, [&](u16 a) { return mem.peek(a); }); });
+            report(name, rounds * (last - first + 1), ref, opt);
+        };
+
+        auto c64Poke = [&](u16 first, u16 last, const char *name) {
+
+            auto ref = measure([&]() { run(first, last, [&](u16 a) { mem.poke(a, u8(a), mem.getPokeTarget(a)); return 0; }); });
+            auto opt = measure([&]() { run(first, last, [&](u16 a) { mem.poke(a, u8(a)); return 0; }); });
+            report(name, rounds * (last - first + 1), ref, opt);
+        };
+
+        auto drvPeek = [&](u16 first, u16 last, const char *name) {
+
+            auto ref = measure([&]() { run(first, last, [&](u16 a) { return drv.peek(a, drv.usage[a >> 10]); }); });
+            auto opt = measure([&]() { run(first, last, [&](u16 a) { return drv.peek(a); }); });
+            report(name, rounds * (last - first + 1), ref, opt);
+        };
+
+        c64Peek(0x0200, 0x9FFF, "C64 RAM read");
+        c64Peek(0xE000, 0xFFFF, "C64 Kernal read");
+        c64Poke(0x0200, 0x9FFF, "C64 RAM write");
+        drvPeek(0x0000, 0x07FF, "Drive RAM read");
+        drvPeek(0x0800, 0x17FF, "Drive unmapped read");
+        if (drv.hasRom()) drvPeek(0xC000, 0xFFFF, "Drive ROM read");
+
+        (void)sink;
+
+        // Restore the emulator state
+        c64.load(state.ptr);
+    }
+}
+
+
+//
+// Guards
+//
+
+/* Looks up all addresses of the 64KB address space in a guard list holding
+ * many guards. The reference model is the linear scan over the guard list,
+ * which is compared with the presence bitmap check. The guard list is not
+ * connected to the CPU debugger, so that the user's guards stay untouched.
+ */
+void
+Benchmark::guards(C64 &c64)
+{
+    struct Scratch : peddle::Guards {
+
+        using Guards::Guards;
+        void setNeedsCheck(bool value) override { }
+    };
+
+    constexpr isize rounds = 16;
+
+    Scratch guards(c64.cpu);
+    volatile isize sink = 0;
+
+    auto run = [&](auto lookup) {
+
+        isize hits = 0;
+        for (isize i = 0; i < rounds; i++) {
+            for (u32 addr = 0; addr < 0x10000; addr++) hits += lookup(addr);
+        }
+        sink = hits;
+    };
+
+    for (long count : { 1, 8, 64, 256 }) {
+
+        guards.removeAll();
+        for (long i = 0; i < count; i++) guards.addAt(u32(0x0800 + 0xF1 * i) & 0xFFFF);
+
+        auto ref = measure([&]() { run([&](u32 addr) {
+
+            for (long i = 0; i < guards.elements(); i++) {
+                if (guards.guardAddr(i) == addr) return true;
+            }
+            return false;
+        }); });
+        auto opt = measure([&]() { run([&](u32 addr) { return guards.isSetAt(addr); }); });
+
+        report(std::to_string(count) + " guards", rounds * 0x10000, ref, opt);
+    }
+
+    (void)sink;
+}
+
+
+
+//
+// Event scheduler
+//
+
+/* Replays the trigger updates of C64::processEvents() for a program that
+ * keeps both CIAs busy. While a CIA timer is running, the CIA reschedules its
+ * slot every cycle. All other slots fire rarely. The reference model keeps all
+ * slots on a single level and rescans the whole trigger array whenever a slot
+ * fires. The optimized model mirrors the three-level slot hierarchy of the
+ * emulator where the secondary and tertiary levels are only rescanned if one
+ * of their slots is due.
+ */
+template <bool linear> static i64
+replayEvents(Cycle cycles)
+{
+    Cycle trigger[SLOT_COUNT];
+    Cycle period[SLOT_COUNT] = { };
+    Cycle nextTrigger = 1;
+    i64 events = 0;
+
+    period[SLOT_CIA1] = 1;
+    period[SLOT_CIA2] = 2;
+    period[SLOT_IEC] = 317;
+    period[SLOT_DAT] = 2011;
+    period[SLOT_KEY] = 19656;
+    period[SLOT_INS] = 98525;
+
+    for (isize i = 0; i < SLOT_COUNT; i++) trigger[i] = period[i] ? period[i] : NEVER;
+    trigger[SLOT_TER] = std::min(trigger[SLOT_KEY], trigger[SLOT_INS]);
+    trigger[SLOT_SEC] = std::min({ trigger[SLOT_IEC], trigger[SLOT_DAT], trigger[SLOT_TER] });
+
+    auto service = [&](isize s, Cycle cycle) {
+
+        if (cycle >= trigger[s]) { trigger[s] = cycle + period[s]; events++; }
+    };
+
+    for (Cycle cycle = 1; cycle <= cycles; cycle++) {
+
+        if (nextTrigger > cycle) continue;
+
+        if constexpr (linear) {
+
+            for (isize i = 0; i < SLOT_COUNT; i++) {
+                if (i != SLOT_SEC && i != SLOT_TER) service(i, cycle);
+            }
+
+            Cycle next = NEVER;
+            for (isize i = 0; i < SLOT_COUNT; i++) {
+                if (i != SLOT_SEC && i != SLOT_TER && trigger[i] < next) next = trigger[i];
+            }
+            nextTrigger = next;
+
+        } else {
+
+            service(SLOT_CIA1, cycle);
+            service(SLOT_CIA2, cycle);
+
+            if (cycle >= trigger[SLOT_SEC]) {
+
+                service(SLOT_IEC, cycle);
+                service(SLOT_DAT, cycle);
+
+                if (cycle >= trigger[SLOT_TER]) {
+
+                    for (isize i = SLOT_TER + 1; i < SLOT_COUNT; i++) service(i, cycle);
+
+                    Cycle next = trigger[SLOT_TER + 1];
+                    for (isize i = SLOT_TER + 2; i < SLOT_COUNT; i++) {
+                        if (trigger[i] < next) next = trigger[i];
+                    }
+                    trigger[SLOT_TER] = next;
+                }
+
+                Cycle next = trigger[SLOT_SEC + 1];
+                for (isize i = SLOT_SEC + 2; i <= SLOT_TER; i++) {
+                    if (trigger[i] < next) next = trigger[i];
+                }
+                trigger[SLOT_SEC] = next;
+            }
+
+            Cycle next = trigger[0];
+            for (isize i = 1; i <= SLOT_SEC; i++) {
+                if (trigger[i] < next) next = trigger[i];
+            }
+            nextTrigger = next;
+        }
+    }
+
+    return events;
+}
+
+void
+Benchmark::events(C64 &c64)
+{
+    constexpr Cycle cycles = 985248 * 10;
+    volatile i64 sink = 0;
+    i64 refEvents = 0, optEvents = 0;
+
+    auto ref = measure([&]() { sink = refEvents = replayEvents<true>(cycles); });
+    auto opt = measure([&]() { sink = optEvents = replayEvents<false>(cycles); });
+
+    report("Event scheduler", cycles, ref, opt);
+    os << util::tab("Output");
+    os << (refEvents == optEvents ? "Identical" : "MISMATCH") << std::endl;
+
+    (void)sink;
+}
+
+}
@@ -0,0 +1,77 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Aliases.h"
+#include <functional>
+#include <ostream>
+#include <vector>
+
+namespace vc64 {
+
+class C64;
+
+/* Microbenchmarks for the performance critical parts of the emulator. Each
+ * benchmark times an optimized code path against a reference implementation
+ * and reports both figures. The reference implementations only exist in this
+ * file, which is compiled into the vc64Bench app, not into the emulator.
+ */
+class Benchmark {
+
+    // Output stream
+    std::ostream &os;
+
+public:
+
+    Benchmark(std::ostream &os) : os(os) { }
+
+    // Runs the benchmarks with the given names (all if the list is empty)
+    int run(C64 &c64, const std::vector<string> &names);
+
+    // Snapshot serializer (C64::save, C64::load, Snapshot::compress)
+    void snapshot(C64 &c64);
+
+    // Audio pipeline (Muxer::mixMultiSID, StereoStream::copyStereo)
+    void audio(C64 &c64);
+
+    // FIR resampler (reSID convolution kernels)
+    void resample(C64 &c64);
+
+    // Canvas renderer (VICII::drawCanvasFastPath)
+    void canvas(C64 &c64);
+
+    // CPU instruction dispatch (Peddle::execute)
+    void cpu(C64 &c64);
+
+    // Memory accesses (C64Memory::peek, C64Memory::poke, DriveMemory::peek)
+    void memory(C64 &c64);
+
+    // Breakpoint and watchpoint lookups (Guards::isSetAt)
+    void guards(C64 &c64);
+
+    // Event scheduler (C64::processEvents)
+    void events(C64 &c64);
+
+private:
+
+    // Runs a function repeatedly and returns the fastest run in nanoseconds
+    i64 measure(std::function<void()> func, isize runs = 5);
+
+    // Prints the result of a single benchmark
+    void report(const string &name, i64 ops, i64 refNanos, i64 nanos);
+
+    // Prints the latency of an operation without a reference implementation
+    void report(const string &name, i64 nanos);
+};
+
+}
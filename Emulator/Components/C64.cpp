@@ -171,6 +171,17 @@ C64::eventName(EventSlot slot, EventID id)
             }
             break;
 
+        case SLOT_INP:
+
+            switch (id) {
+
+                case EVENT_NONE:    return "none";
+                case INP_RECORD:    return "INP_RECORD";
+                case INP_REPLAY:    return "INP_REPLAY";
+                default:            return "*** INVALID ***";
+            }
+            break;
+
         case SLOT_INS:
 
             switch (id) {
@@ -208,6 +219,7 @@ C64::C64()
         &port2,
         &expansionport,
         &iec,
+        &inputRecorder,
         &keyboard,
         &drive8,
         &drive9,
@@ -215,6 +227,8 @@ C64::C64()
         &datasette,
         &retroShell,
         &regressionTester,
+        &profiler,
+        &rewinder,
         &recorder,
         &msgQueue
     };
@@ -233,7 +247,8 @@ C64::C64()
 C64::~C64()
 {
     debug(RUN_DEBUG, "Destroying emulator instance\n");
-    if (thread.joinable()) { halt(); }
+    if (thread.joinable() || pool) { halt(); }
+    haltDriveThread();
 }
 
 void
@@ -248,12 +263,22 @@ void
 C64::launch()
 {
     // Make sure to call this function only once
-    assert(!thread.joinable());
+    assert(!thread.joinable() && !pool);
 
     // Start the thread and enter the main function
     thread = std::thread(&Thread::main, this);
 }
 
+void
+C64::launch(ThreadPool &pool)
+{
+    // Make sure to call this function only once
+    assert(!thread.joinable() && !this->pool);
+
+    // Let the pool workers execute the run loop
+    pool.attach(*this);
+}
+
 void
 C64::prefix() const
 {
@@ -319,6 +344,7 @@ C64::_reset(bool hard)
 
     flags = 0;
     rasterCycle = 1;
+    driveCycle = cpu.clock;
     updateWarpState();
 }
 
@@ -335,6 +361,8 @@ C64::resetConfig()
         OPT_TIME_SLICES,
         OPT_AUTO_FPS,
         OPT_PROPOSED_FPS,
+        OPT_DRIVE_SYNC,
+        OPT_RUN_AHEAD,
     };
 
     for (auto &option : options) {
@@ -372,8 +400,18 @@ C64::getConfigItem(Option option) const
 
             return config.proposedFps;
 
+        case OPT_DRIVE_SYNC:
+
+            return config.driveSync;
+
+        case OPT_RUN_AHEAD:
+
+            return config.runAhead;
+
         case OPT_VIC_REVISION:
         case OPT_VIC_POWER_SAVE:
+        case OPT_VIC_HEADLESS:
+        case OPT_VIC_INDEXED:
         case OPT_GRAY_DOT_BUG:
         case OPT_GLUE_LOGIC:
         case OPT_HIDE_SPRITES:
@@ -400,12 +438,18 @@ C64::getConfigItem(Option option) const
 
         case OPT_POWER_GRID:
             return supply.getConfigItem(option);
+
+        case OPT_REWIND_HISTORY:
+        case OPT_REWIND_RATE:
+        case OPT_REWIND_MEMORY:
+            return rewinder.getConfigItem(option);
             
         case OPT_SID_REVISION:
         case OPT_SID_POWER_SAVE:
         case OPT_SID_FILTER:
         case OPT_SID_ENGINE:
         case OPT_SID_SAMPLING:
+        case OPT_SID_PARALLEL:
         case OPT_AUDVOLL:
         case OPT_AUDVOLR:
             return muxer.getConfigItem(option);
@@ -537,6 +581,24 @@ C64::setConfigItem(Option option, i64 value)
             updateClockFrequency();
             return;
 
+        case OPT_DRIVE_SYNC:
+
+            if (!DriveSyncEnum::isValid(value)) {
+                throw VC64Error(ERROR_OPT_INVARG, DriveSyncEnum::keyList());
+            }
+
+            config.driveSync = DriveSync(value);
+            return;
+
+        case OPT_RUN_AHEAD:
+
+            if (value < 0 || value > 4) {
+                throw VC64Error(ERROR_OPT_INVARG, "0...4");
+            }
+
+            config.runAhead = isize(value);
+            return;
+
         default:
             fatalError;
     }
@@ -579,6 +641,8 @@ C64::configure(Option option, i64 value)
         case OPT_TIME_SLICES:
         case OPT_AUTO_FPS:
         case OPT_PROPOSED_FPS:
+        case OPT_DRIVE_SYNC:
+        case OPT_RUN_AHEAD:
 
             setConfigItem(option, value);
             break;
@@ -590,6 +654,8 @@ C64::configure(Option option, i64 value)
         case OPT_SATURATION:
         case OPT_GRAY_DOT_BUG:
         case OPT_VIC_POWER_SAVE:
+        case OPT_VIC_HEADLESS:
+        case OPT_VIC_INDEXED:
         case OPT_HIDE_SPRITES:
         case OPT_SS_COLLISIONS:
         case OPT_SB_COLLISIONS:
@@ -612,6 +678,13 @@ C64::configure(Option option, i64 value)
             supply.setConfigItem(option, value);
             break;
 
+        case OPT_REWIND_HISTORY:
+        case OPT_REWIND_RATE:
+        case OPT_REWIND_MEMORY:
+
+            rewinder.setConfigItem(option, value);
+            break;
+
         case OPT_CIA_REVISION:
         case OPT_TIMER_B_BUG:
             
@@ -632,6 +705,7 @@ C64::configure(Option option, i64 value)
         case OPT_SID_SAMPLING:
         case OPT_SID_POWER_SAVE:
         case OPT_SID_ENGINE:
+        case OPT_SID_PARALLEL:
         case OPT_AUDPAN:
         case OPT_AUDVOL:
         case OPT_AUDVOLL:
@@ -766,6 +840,7 @@ C64::configure(Option option, long id, i64 value)
         case OPT_SID_POWER_SAVE:
         case OPT_SID_ENGINE:
         case OPT_SID_SAMPLING:
+        case OPT_SID_PARALLEL:
         case OPT_AUDPAN:
         case OPT_AUDVOL:
         case OPT_AUDVOLL:
@@ -1035,10 +1110,58 @@ C64::getSyncMode() const
 
 void
 C64::execute()
+{
+    auto lastFrame = frame;
+
+    executeSlice();
+
+    if (frame != lastFrame) {
+
+        // Record a state for the rewind history if one is due
+        rewinder.vsyncHandler();
+
+        // Emulate the run-ahead frames
+        if (canRunAhead()) runAhead();
+    }
+
+    // Show the current frame if no run-ahead frame has replaced it
+    vic.releaseFrame();
+}
+
+void
+C64::executeSlice()
 {
     cpu.debugger.watchpointPC = -1;
     cpu.debugger.breakpointPC = -1;
 
+    /* Check if the drives can catch up with the C64 lazily. This is not
+     * possible if a parallel cable is attached, because the drives may
+     * trigger a C64 interrupt via the handshake lines at any time. It is also
+     * not possible if a breakpoint or watchpoint is set in a drive CPU,
+     * because the emulator has to stop in the cycle where the guard hits.
+     */
+    catchUp =
+    config.driveSync != DRIVE_SYNC_LOCKSTEP &&
+    (drive8.needsEmulation || drive9.needsEmulation) &&
+    !drive8.hasParCable() && !drive9.hasParCable() &&
+    !drive8.cpu.checksGuards() && !drive9.cpu.checksGuards();
+
+    if (catchUp) {
+
+        catchUp8 = drive8.needsEmulation;
+        catchUp9 = drive9.needsEmulation;
+        driveCycle = cpu.clock;
+
+        threaded = config.driveSync == DRIVE_SYNC_THREADED && !isPooled();
+        if (threaded) launchDriveThread();
+
+        execute <false,false> ();
+
+        syncDrives(cpu.clock);
+        catchUp = threaded = false;
+        return;
+    }
+
     switch ((drive8.needsEmulation ? 2 : 0) + (drive9.needsEmulation ? 1 : 0)) {
 
         case 0b00: execute <false,false> (); break;
@@ -1058,6 +1181,8 @@ C64::execute()
     auto lastCycle = vic.getCyclesPerLine();
     auto syncLine = nextSyncLine(scanline);
 
+    profiler.start();
+
     do {
 
         //
@@ -1093,7 +1218,9 @@ C64::execute()
             //
 
             if (nextTrigger <= cycle) processEvents(cycle);
+            profiler.lap(PROF_EVENTS);
             (vic.*vic.vicfunc[rasterCycle])();
+            profiler.lap(PROF_VICII);
 
 
             //
@@ -1101,8 +1228,15 @@ C64::execute()
             //
 
             cpu.execute<MOS_6510>();
-            if constexpr (enable8) { drive8.execute(durationOfOneCycle); }
-            if constexpr (enable9) { drive9.execute(durationOfOneCycle); }
+            profiler.lap(PROF_CPU);
+            if constexpr (enable8) {
+                drive8.execute(durationOfOneCycle);
+                profiler.lap(PROF_DRIVE8);
+            }
+            if constexpr (enable9) {
+                drive9.execute(durationOfOneCycle);
+                profiler.lap(PROF_DRIVE9);
+            }
 
 
             //
@@ -1123,6 +1257,214 @@ C64::execute()
     trace(TIM_DEBUG, "Syncing at scanline %d\n", scanline);
 }
 
+void
+C64::catchUpDrives(Cycle cycle)
+{
+    auto start = profiler.stamp();
+
+    while (driveCycle < cycle) {
+
+        catchingUp = true;
+        stepDrives(cycle);
+        catchingUp = false;
+
+        processPendingUpdates();
+    }
+
+    chargeDrives(start);
+}
+
+void
+C64::chargeDrives(i64 start)
+{
+    if (catchUp8 && catchUp9) {
+        profiler.charge(start, PROF_DRIVE8, PROF_DRIVE9);
+    } else {
+        profiler.charge(start, catchUp8 ? PROF_DRIVE8 : PROF_DRIVE9);
+    }
+}
+
+void
+C64::stepDrives(Cycle cycle)
+{
+    if (catchUp8 && catchUp9) {
+
+        // Both drives may affect each other. Emulate them cycle by cycle
+        drive8.execute(durationOfOneCycle);
+        drive9.execute(durationOfOneCycle);
+        driveCycle++;
+
+    } else {
+
+        // Emulate a single drive until it writes to the IEC bus
+        auto &drive = catchUp8 ? drive8 : drive9;
+        driveCycle += drive.execute(cycle - driveCycle, durationOfOneCycle);
+    }
+}
+
+void
+C64::processPendingUpdates()
+{
+    if (iec.pendingUpdate) {
+
+        if (driveCycle < cpu.clock) {
+
+            /* The update would already have been processed in lockstep. The
+             * flag keeps nested update requests out of the event table.
+             */
+            catchingUp = true;
+            iec.update();
+            catchingUp = false;
+
+        } else {
+
+            // Let the event scheduler process the update in the next cycle
+            iec.pendingUpdate = false;
+            scheduleImm<SLOT_IEC>(IEC_UPDATE);
+        }
+    }
+
+    if (iec.pendingStatus) {
+
+        iec.pendingStatus = false;
+        iec.updateTransferStatus();
+    }
+}
+
+void
+C64::releaseDrives()
+{
+    if (driveOwner.load(std::memory_order_acquire) == OWNER_C64) {
+
+        processPendingUpdates();
+
+        driveLimit.store(cpu.clock, std::memory_order_relaxed);
+        driveOwner.store(OWNER_DRIVE_THREAD, std::memory_order_release);
+        driveOwner.notify_one();
+
+    } else {
+
+        // The drive thread is still running. Raise the cycle limit
+        driveLimit.store(cpu.clock, std::memory_order_release);
+    }
+}
+
+void
+C64::reclaimDrives()
+{
+    auto start = profiler.stamp();
+
+    driveOwner.wait(OWNER_DRIVE_THREAD, std::memory_order_acquire);
+    processPendingUpdates();
+
+    chargeDrives(start);
+}
+
+void
+C64::launchDriveThread()
+{
+    if (!driveThread.joinable()) {
+
+        debug(RUN_DEBUG, "Launching the drive thread\n");
+        driveThread = std::thread(&C64::runDriveThread, this);
+    }
+}
+
+void
+C64::haltDriveThread()
+{
+    if (driveThread.joinable()) {
+
+        debug(RUN_DEBUG, "Halting the drive thread\n");
+
+        driveOwner.store(OWNER_NONE, std::memory_order_release);
+        driveOwner.notify_one();
+        driveThread.join();
+        driveOwner = OWNER_C64;
+    }
+}
+
+void
+C64::runDriveThread()
+{
+    catchingUp = true;
+
+    while (true) {
+
+        // Wait until the C64 thread hands over the drives
+        driveOwner.wait(OWNER_C64, std::memory_order_acquire);
+        if (driveOwner.load(std::memory_order_acquire) == OWNER_NONE) break;
+
+        // Emulate the drives until the limit is reached or the bus changes
+        while (!iec.pendingUpdate) {
+
+            auto limit = driveLimit.load(std::memory_order_acquire);
+            if (driveCycle >= limit) break;
+
+            stepDrives(limit);
+        }
+
+        // Return the drives to the C64 thread
+        driveOwner.store(OWNER_C64, std::memory_order_release);
+        driveOwner.notify_one();
+    }
+}
+
+bool
+C64::isVisibleFrame() const
+{
+    return isRunningAhead() ? aheadFrames == 1 : !canRunAhead();
+}
+
+bool
+C64::canRunAhead() const
+{
+    /* Run-ahead frames are skipped if the emulator is debugged, warps, or
+     * records, and while the keyboard types automatically, RetroShell scripts
+     * are executed, or alarms are pending. The latter rely on state that is
+     * not part of a snapshot and would be consumed by the run-ahead frames.
+     */
+    return
+    config.runAhead > 0 &&
+    !isWarping() && !isTracking() && !recorder.isRecording() &&
+    cpu.debugger.breakpoints.elements() == 0 &&
+    cpu.debugger.watchpoints.elements() == 0 &&
+    !isPending<SLOT_KEY>() && !isPending<SLOT_RSH>() && !isPending<SLOT_ALA>();
+}
+
+void
+C64::runAhead()
+{
+    // Only proceed if no run loop flags are pending
+    if (flags) return;
+
+    // Defer input events from other threads until the state has been restored
+    util::AutoMutex lock1(keyboard.getMutex());
+    util::AutoMutex lock2(port1.joystick.getMutex());
+    util::AutoMutex lock3(port2.joystick.getMutex());
+    util::AutoMutex lock4(port1.mouse.getMutex());
+    util::AutoMutex lock5(port2.mouse.getMutex());
+
+    // Save the current state
+    aheadState.alloc(size());
+    saveUnchecked(aheadState.ptr);
+
+    // Emulate the run-ahead frames
+    for (aheadFrames = config.runAhead; aheadFrames > 0; aheadFrames--) {
+
+        auto lastFrame = frame;
+        while (frame == lastFrame && !flags) executeSlice();
+
+        // Stop if the run loop has been interrupted
+        if (flags) break;
+    }
+    aheadFrames = 0;
+
+    // Revert to the saved state
+    loadUnchecked(aheadState.ptr);
+    didLoad();
+}
+
 isize 
 C64::nextSyncLine(isize line)
 {
@@ -1140,6 +1482,18 @@ C64::nextSyncLine(isize line)
 bool
 C64::processFlags()
 {
+    syncDrives(cpu.clock);
+
+    /* Flags raised in run-ahead frames are discarded together with the state
+     * they refer to. Flags raised from outside terminate the run-ahead frames
+     * and are processed in the next iteration of the real time line.
+     */
+    if (isRunningAhead()) {
+
+        clearFlag(RL::BREAKPOINT | RL::WATCHPOINT | RL::CPU_JAM);
+        return true;
+    }
+
     // The following flags will terminate the loop
     bool exit = flags & (RL::BREAKPOINT |
                          RL::WATCHPOINT |
@@ -1369,6 +1723,8 @@ C64::_inspect() const
 isize
 C64::load(const u8 *buffer)
 {
+    assert(!isRunning());
+
     auto result = CoreComponent::load(buffer);
     CoreComponent::didLoad();
 
@@ -1403,6 +1759,10 @@ C64::_dump(Category category, std::ostream& os) const
         os << bol(config.autoFps) << std::endl;
         os << tab("Proposed fps");
         os << config.proposedFps << " Fps" << std::endl;
+        os << tab("Drive sync");
+        os << DriveSyncEnum::key(config.driveSync) << std::endl;
+        os << tab("Run ahead");
+        os << config.runAhead << " frames" << std::endl;
         os << std::endl;
     }
 
@@ -1551,31 +1911,46 @@ C64::endScanline()
     vic.endScanline();
     rasterCycle = 1;
     scanline++;
+    profiler.lap(PROF_OTHER);
     
     if (scanline >= vic.getLinesPerFrame()) {
         scanline = 0;
         endFrame();
     }
+
+    if (threaded) releaseDrives();
 }
 
 void
 C64::endFrame()
 {
+    syncDrives(cpu.clock);
+
     frame++;
     
     vic.endFrame();
+    profiler.lap(PROF_VICII);
 
     // Execute remaining SID cycles
     muxer.executeUntil(cpu.clock);
-    
+    profiler.lap(PROF_SID);
+
     // Execute other components
     iec.execute();
+    profiler.lap(PROF_IEC);
     expansionport.execute();
     port1.execute();
     port2.execute();
+    profiler.lap(PROF_PORTS);
     drive8.vsyncHandler();
+    profiler.lap(PROF_DRIVE8);
     drive9.vsyncHandler();
+    profiler.lap(PROF_DRIVE9);
     recorder.vsyncHandler();
+    profiler.lap(PROF_RECORDER);
+
+    // Complete the profiler measurements
+    profiler.endFrame();
 }
 
 void
@@ -1599,7 +1974,9 @@ C64::processEvents(Cycle cycle)
         //
 
         if (isDue<SLOT_IEC>(cycle)) {
-            iec.update();
+
+            syncDrives(cycle - 1);
+            if (isDue<SLOT_IEC>(cycle)) iec.update();
         }
 
         if (isDue<SLOT_DAT>(cycle)) {
@@ -1617,12 +1994,15 @@ C64::processEvents(Cycle cycle)
             }
 
             if (isDue<SLOT_DC8>(cycle)) {
+                syncDrives(cycle - 1);
                 drive8.processDiskChangeEvent(id[SLOT_DC8]);
             }
             if (isDue<SLOT_DC9>(cycle)) {
+                syncDrives(cycle - 1);
                 drive9.processDiskChangeEvent(id[SLOT_DC9]);
             }
             if (isDue<SLOT_RSH>(cycle)) {
+                syncDrives(cycle - 1);
                 retroShell.serviceEvent();
             }
             if (isDue<SLOT_KEY>(cycle)) {
@@ -1634,6 +2014,9 @@ C64::processEvents(Cycle cycle)
             if (isDue<SLOT_ALA>(cycle)) {
                 processAlarmEvent();
             }
+            if (isDue<SLOT_INP>(cycle)) {
+                inputRecorder.serviceEvent(id[SLOT_INP]);
+            }
             if (isDue<SLOT_INS>(cycle)) {
 
                 processINSEvent(id[SLOT_INS]);
@@ -1786,6 +2169,9 @@ C64::loadSnapshot(const Snapshot &snapshot)
 
         try {
 
+            // Snapshots are not part of an input movie
+            inputRecorder.stop();
+
             // Restore the saved state
             load(snapshot.getData());
 
@@ -1812,6 +2198,25 @@ C64::loadSnapshot(const Snapshot &snapshot)
     msgQueue.put(MSG_SNAPSHOT_RESTORED);
 }
 
+void
+C64::rewind(isize steps)
+{
+    {   SUSPENDED
+
+        // Rewinding ends an input movie
+        inputRecorder.stop();
+
+        // Restore the recorded state
+        if (!rewinder.rewind(steps)) return;
+
+        // Clear the keyboard matrix to avoid constantly pressed keys
+        keyboard.releaseAll();
+    }
+
+    // Inform the GUI
+    msgQueue.put(MSG_SNAPSHOT_RESTORED);
+}
+
 u32
 C64::romCRC32(RomType type) const
 {
@@ -2405,6 +2810,7 @@ C64::setDebugVariable(const string &name, int val)
     else if (name == "LIP_DEBUG")       LIP_DEBUG       = val;
 
     else if (name == "REC_DEBUG")       REC_DEBUG       = val;
+    else if (name == "INP_DEBUG")       INP_DEBUG       = val;
     else if (name == "REU_DEBUG")       REU_DEBUG       = val;
 
     else {
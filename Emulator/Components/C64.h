@@ -16,6 +16,7 @@
 #include "Defaults.h"
 #include "MsgQueue.h"
 #include "Thread.h"
+#include "ThreadPool.h"
 
 // Sub components
 #include "Host.h"
@@ -33,7 +34,10 @@
 #include "CPU.h"
 #include "PowerSupply.h"
 #include "Recorder.h"
+#include "Profiler.h"
 #include "RegressionTester.h"
+#include "Rewinder.h"
+#include "InputRecorder.h"
 #include "RetroShell.h"
 
 // Cartridges
@@ -86,6 +90,8 @@ static constexpr double inspectionInterval = 0.1;
  */
 class C64 : public Thread {
 
+    friend class Headless;
+
     // The current configuration
     C64Config config = {};
 
@@ -131,6 +137,9 @@ public:
     // Misc
     RetroShell retroShell = RetroShell(*this);
     RegressionTester regressionTester = RegressionTester(*this);
+    Profiler profiler = Profiler(*this);
+    Rewinder rewinder = Rewinder(*this);
+    InputRecorder inputRecorder = InputRecorder(*this);
     Recorder recorder = Recorder(*this);
     MsgQueue msgQueue = MsgQueue(*this);
 
@@ -168,6 +177,51 @@ private:
      */
     RunLoopFlags flags = 0;
 
+    /* Indicates whether the floppy drives are emulated in catch-up mode. In
+     * this mode, the drives are not executed inside the run loop. They lag
+     * behind the C64 and catch up whenever the C64 interacts with them.
+     */
+    bool catchUp = false;
+
+    // Indicates which drives are emulated in catch-up mode
+    bool catchUp8 = false;
+    bool catchUp9 = false;
+
+    // The C64 cycle up to which the drives have been emulated
+    Cycle driveCycle = 0;
+
+    // Indicates whether the drives are catching up in the calling host thread
+    static inline thread_local bool catchingUp = false;
+
+    /* Indicates whether the drives are emulated on a separate host thread. In
+     * this mode, the drives catch up inside the drive thread while the C64
+     * runs. Ownership of the drives is handed over at the end of each
+     * scanline. The C64 thread takes it back whenever it needs to synchronize
+     * the drives, and the drive thread returns it as soon as it has reached
+     * the cycle limit or a drive has written to the IEC bus.
+     */
+    bool threaded = false;
+
+    // The drive thread
+    std::thread driveThread;
+
+    // Indicates which thread is allowed to emulate the drives
+    enum { OWNER_C64, OWNER_DRIVE_THREAD, OWNER_NONE };
+    std::atomic<int> driveOwner = OWNER_C64;
+
+    // The C64 cycle up to which the drive thread may emulate the drives
+    std::atomic<Cycle> driveLimit = 0;
+
+    /* Number of frames that remain to be emulated in run-ahead mode. In this
+     * mode, the C64 emulates a couple of frames ahead of time after each
+     * frame, displays the last one and reverts to the saved state. The
+     * variable is 0 while the real time line is emulated.
+     */
+    isize aheadFrames = 0;
+
+    // The state the run-ahead frames are emulated from
+    util::Buffer<u8> aheadState;
+
     
     //
     // Storage
@@ -250,6 +304,9 @@ public:
     void launch();
     void launch(const void *listener, Callback *func);
 
+    // Hands the emulator over to a thread pool instead of launching a thread
+    void launch(ThreadPool &pool);
+
 
     //
     // Methods from CoreObject
@@ -386,6 +443,7 @@ private:
 
     SyncMode getSyncMode() const override;
     void execute() override;
+    void executeSlice();
     template <bool enable8, bool enable9> void execute();
     isize nextSyncLine(isize scanline);
     bool processFlags();
@@ -414,6 +472,7 @@ private:
     void _trackOn() override;
     void _trackOff() override;
     void _inspect() const override;
+    void _didLoad() override { driveCycle = cpu.clock; }
 
     
     //
@@ -468,9 +527,62 @@ public:
     
     // Finishes the current frame
     void finishFrame();
-    
+
+    /* Brings the floppy drives up to date in catch-up mode. After the call,
+     * the drives have been emulated up to and including the specified C64
+     * cycle. The function has no effect if the drives run in lockstep.
+     */
+    void syncDrives(Cycle cycle) {
+
+        if (catchUp) {
+
+            if (threaded) reclaimDrives();
+            if (cycle > driveCycle) catchUpDrives(cycle);
+        }
+    }
+
+    // Indicates whether a drive is executed inside syncDrives()
+    bool isCatchingUp() const { return catchingUp; }
+
+    // Indicates whether the current frame is emulated ahead of time
+    bool isRunningAhead() const { return aheadFrames > 0; }
+
+    // Indicates whether the current frame will be shown to the user
+    bool isVisibleFrame() const;
+
+    // Checks whether run-ahead frames can be emulated after the current frame
+    bool canRunAhead() const;
+
 private:
 
+    // Work horse for syncDrives()
+    void catchUpDrives(Cycle cycle);
+
+    // Emulates the drives for a single cycle or a batch of cycles
+    void stepDrives(Cycle cycle);
+
+    // Charges the time spent in catch-up mode to the drives in the profiler
+    void chargeDrives(i64 start);
+
+    // Performs the IEC bus updates the drives have requested while catching up
+    void processPendingUpdates();
+
+    // Hands over the drives to the drive thread
+    void releaseDrives();
+
+    // Waits until the drive thread has returned the drives
+    void reclaimDrives();
+
+    // Starts or terminates the drive thread
+    void launchDriveThread();
+    void haltDriveThread();
+
+    // The entry point of the drive thread
+    void runDriveThread();
+
+    // Emulates the run-ahead frames and restores the current state afterwards
+    void runAhead();
+
     // Invoked after executing the last cycle of a scanline
     void endScanline();
     
@@ -620,6 +732,9 @@ public:
     
     // Loads the current state from a snapshot file
     void loadSnapshot(const Snapshot &snapshot) throws;
+
+    // Reverts to a state from the rewind history (1 = most recent state)
+    void rewind(isize steps);
     
     
     //
@@ -75,6 +75,7 @@ enum_long(SLOT)
     SLOT_KEY,                       // Auto-typing
     SLOT_WBT,                       // Warp boot
     SLOT_ALA,                       // Alarms (set by the GUI)
+    SLOT_INP,                       // Input recorder
     SLOT_INS,                       // Handles periodic calls to inspect()
 
     SLOT_COUNT
@@ -107,6 +108,7 @@ struct EventSlotEnum : util::Reflection<EventSlotEnum, EventSlot>
             case SLOT_KEY:      return "KEY";
             case SLOT_WBT:      return "WBT";
             case SLOT_ALA:      return "ALA";
+            case SLOT_INP:      return "INP";
             case SLOT_INS:      return "INS";
 
             case SLOT_COUNT:    return "???";
@@ -178,6 +180,11 @@ enum_i8(EventID)
     ALA_TRIGGER         = 1,
     ALA_EVENT_COUNT,
 
+    // Input recorder
+    INP_RECORD          = 1,
+    INP_REPLAY,
+    INP_EVENT_COUNT,
+
     // Inspector slot
     INS_C64             = 1,
     INS_CPU,
@@ -218,6 +225,35 @@ struct WarpModeEnum : util::Reflection<WarpModeEnum, WarpMode>
 };
 #endif
 
+enum_long(DRIVE_SYNC)
+{
+    DRIVE_SYNC_LOCKSTEP,
+    DRIVE_SYNC_CATCHUP,
+    DRIVE_SYNC_THREADED
+};
+typedef DRIVE_SYNC DriveSync;
+
+#ifdef __cplusplus
+struct DriveSyncEnum : util::Reflection<DriveSyncEnum, DriveSync>
+{
+    static constexpr long minVal = 0;
+    static constexpr long maxVal = DRIVE_SYNC_THREADED;
+    static bool isValid(auto val) { return val >= minVal && val <= maxVal; }
+
+    static const char *prefix() { return "DRIVE_SYNC"; }
+    static const char *key(DriveSync value)
+    {
+        switch (value) {
+
+            case DRIVE_SYNC_LOCKSTEP:   return "LOCKSTEP";
+            case DRIVE_SYNC_CATCHUP:    return "CATCHUP";
+            case DRIVE_SYNC_THREADED:   return "THREADED";
+        }
+        return "???";
+    }
+};
+#endif
+
 enum_long(ROM_TYPE)
 {
     ROM_TYPE_BASIC,
@@ -301,6 +337,8 @@ typedef struct
     bool autoFps;
     isize proposedFps;
     isize timeSlices;
+    DriveSync driveSync;
+    isize runAhead;
 }
 C64Config;
 
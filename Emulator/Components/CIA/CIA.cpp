@@ -946,9 +946,20 @@ CIA2::computePB() const
     return parCable.getValue();
 }
 
+u8
+CIA2::peekPA()
+{
+    // The IEC lines are only up to date if the drives have caught up
+    c64.syncDrives(cpu.clock - 1);
+
+    return CIA::peekPA();
+}
+
 void
 CIA2::pokePRA(u8 value)
 {
+    c64.syncDrives(cpu.clock - 1);
+
     CIA::pokePRA(value);
     
     // PA0 (VA14) and PA1 (VA15) determine the memory bank seen by VICII
@@ -964,6 +975,8 @@ CIA2::pokePRB(u8 value)
 void
 CIA2::pokeDDRA(u8 value)
 {
+    c64.syncDrives(cpu.clock - 1);
+
     CIA::pokeDDRA(value);
     
     // PA0 (VA14) and PA1 (VA15) determine the memory bank seen by VICII
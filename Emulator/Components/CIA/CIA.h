@@ -614,6 +614,7 @@ private:
     u8 portBexternal() const override;
     void updatePB() override;
     u8 computePB() const override;
+    u8 peekPA() override;
     void pokePRA(u8 value) override;
     void pokePRB(u8 value) override;
     void pokeDDRA(u8 value) override;
@@ -369,7 +369,15 @@ Peddle::read(u16 addr)
 
         if (addr < 2) return addr ? readPort() : readPortDir();
     }
-    return read(addr & addrMask<C>());
+
+    switch (C) {
+
+        case MOS_6510: return mem.peek(addr);
+        case MOS_6502: return id == 1 ? drive8.mem.peek(addr) : drive9.mem.peek(addr);
+
+        default:
+            return read(addr & addrMask<C>());
+    }
 }
 template u8 Peddle::read<MOS_6502>(u16 addr);
 template u8 Peddle::read<MOS_6507>(u16 addr);
@@ -220,6 +220,9 @@ public:
     // Returns true if the next cycle marks the beginning of an instruction
     bool inFetchPhase() const { return next == fetch; }
 
+    // Returns true if breakpoints or watchpoints are checked
+    bool checksGuards() const { return flags & (CPU_CHECK_BP | CPU_CHECK_WP); }
+
 
     //
     // Examining instructions
@@ -246,9 +249,11 @@ public:
     void reset();
     template <CPURevision C> void reset();
 
-    // Exexutes the CPU for a single cycle
+    /* Exexutes the CPU for a single cycle. The template argument selects the
+     * threaded dispatcher or the switch statement (see PeddleConfig.h).
+     */
     void execute();
-    template <CPURevision C> void execute();
+    template <CPURevision C, bool threaded = PEDDLE_THREADED_DISPATCH> void execute();
 
     // Executes the CPU for the specified number of cycles
     void execute(int count);
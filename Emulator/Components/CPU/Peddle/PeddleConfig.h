@@ -35,6 +35,30 @@
  */
 #define PEDDLE_ENABLE_WATCHPOINTS true
 
+/* Instruction dispatch
+ *
+ * Peddle executes a single micro-instruction in each cycle. By default, the
+ * micro-instruction is selected by a switch statement with several hundred
+ * cases. Alternatively, Peddle can jump to the micro-instruction directly by
+ * looking up its entry point in a dispatch table (threaded code). The jump
+ * avoids the range check of the switch statement and is easier to predict.
+ * The threaded dispatcher requires the labels-as-values extension, which is
+ * supported by GCC and Clang. With these compilers, it is always compiled in,
+ * so that it can be benchmarked against the switch statement. This option
+ * only selects the dispatcher used by default. It is disabled, because the
+ * threaded dispatcher hasn't shown a measurable gain yet.
+ *
+ * Enable to use the threaded dispatcher (GCC and Clang only), disable to use
+ * the switch statement.
+ */
+#define PEDDLE_THREADED_DISPATCH false
+
+#if defined(__GNUC__)
+#define PEDDLE_HAS_THREADED_DISPATCH true
+#else
+#define PEDDLE_HAS_THREADED_DISPATCH false
+#endif
+
 /* Memory API
  *
  * Peddle offers two interfaces to interact with the connected memory. The
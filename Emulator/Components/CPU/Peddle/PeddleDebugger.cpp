@@ -48,6 +48,8 @@ Guards::guardWithNr(long nr) const
 Guard *
 Guards::guardAtAddr(u32 addr) const
 {
+    if (!isMarkedAt(addr)) return nullptr;
+
     for (int i = 0; i < count; i++) {
         if (guards[i].addr == addr) return &guards[i];
     }
@@ -106,6 +108,7 @@ Guards::addAt(u32 addr, long skip)
     guards[count].hits = 0;
     guards[count].skip = skip;
     count++;
+    updateBitmap();
     setNeedsCheck(true);
 }
 
@@ -127,6 +130,7 @@ Guards::removeAt(u32 addr)
             break;
         }
     }
+    updateBitmap();
     setNeedsCheck(count != 0);
 }
 
@@ -137,6 +141,19 @@ Guards::replace(long nr, u32 addr)
     
     guards[nr].addr = addr;
     guards[nr].hits = 0;
+    updateBitmap();
+}
+
+void
+Guards::updateBitmap()
+{
+    for (auto &word : bitmap) word = 0;
+
+    for (long i = 0; i < count; i++) {
+
+        u32 addr = guards[i].addr & bitmapMask;
+        bitmap[addr >> 6] |= u64(1) << (addr & 63);
+    }
 }
 
 bool
@@ -161,10 +178,11 @@ Guards::setEnableAt(u32 addr, bool value)
 bool
 Guards::eval(u32 addr)
 {
-    for (int i = 0; i < count; i++)
-        if (guards[i].eval(addr)) return true;
+    // Only evaluate the guard if the presence bitmap reports a hit
+    if (!isMarkedAt(addr)) return false;
 
-    return false;
+    Guard *guard = guardAtAddr(addr);
+    return guard && guard->eval(addr);
 }
 
 void
@@ -52,6 +52,15 @@ protected:
     // Number of currently stored guards
     long count = 0;
 
+    /* Presence bitmap with one bit for each address of a 17-bit address
+     * space. A bit is set if a guard is set at this address. Addresses beyond
+     * 17 bits are folded into the bitmap. Hence, a set bit only indicates that
+     * a guard might be present, whereas a cleared bit guarantees that no
+     * guard is set at the address.
+     */
+    static constexpr u32 bitmapMask = 0x1FFFF;
+    u64 bitmap[(bitmapMask + 1) / 64] = { };
+
     // Indicates if guard checking is necessary
     virtual void setNeedsCheck(bool value) = 0;
     
@@ -80,6 +89,11 @@ public:
     bool isSetAndEnabledAt(u32 addr) const;
     bool isSetAndDisabledAt(u32 addr) const;
     bool isSetAndConditionalAt(u32 addr) const;
+
+    // Performs a quick check by testing the presence bitmap
+    bool isMarkedAt(u32 addr) const {
+        return (bitmap[(addr & bitmapMask) >> 6] >> (addr & 63)) & 1;
+    }
     
     //
     // Adding or removing guards
@@ -89,9 +103,16 @@ public:
     void removeAt(u32 addr);
     
     void remove(long nr);
-    void removeAll() { count = 0; setNeedsCheck(false); }
+    void removeAll() { count = 0; updateBitmap(); setNeedsCheck(false); }
     
     void replace(long nr, u32 addr);
+
+private:
+
+    // Recomputes the presence bitmap
+    void updateBitmap();
+
+public:
     
     //
     // Enabling or disabling guards
@@ -90,6 +90,16 @@ doNmi |= (edgeDetector.delayed() != 0);
 #define CONTINUE next = (MicroInstruction)((int)next+1); return;
 #define DONE     done<C>(); return;
 
+/* Entry point of a micro-instruction. Besides the case label, a regular label
+ * is defined which serves as jump target for the threaded dispatcher.
+ */
+#if PEDDLE_HAS_THREADED_DISPATCH
+#define MICRO(name) case name: name##_label: __attribute__((unused));
+#define MICRO_LABEL(name) &&name##_label,
+#else
+#define MICRO(name) case name:
+#endif
+
 void
 Peddle::adc(u8 op)
 {
@@ -296,14 +306,31 @@ Peddle::execute()
     }
 }
 
-template <CPURevision C> void
+template <CPURevision C, bool threaded> void
 Peddle::execute()
 {
     u8 instr;
-    
+
+#if PEDDLE_HAS_THREADED_DISPATCH
+
+    if constexpr (threaded) {
+
+        // Table storing the entry point of each micro-instruction
+        static void *const dispatch[] = { MICRO_INSTRUCTIONS(MICRO_LABEL) };
+
+        // Jump directly to the next micro-instruction
+        goto *dispatch[next];
+    }
+
+#else
+
+    static_assert(!threaded, "The threaded dispatcher requires computed gotos");
+
+#endif
+
     switch (next) {
             
-        case fetch:
+        MICRO(fetch)
 
             // Check interrupt lines
             if (unlikely(doNmi)) {
@@ -334,12 +361,12 @@ Peddle::execute()
             // Illegal instructions
             //
             
-        case JAM:
+        MICRO(JAM)
 
             cpuDidJam();
             CONTINUE
 
-        case JAM_2:
+        MICRO(JAM_2)
             
             POLL_INT
             DONE
@@ -348,17 +375,17 @@ Peddle::execute()
             // IRQ handling
             //
             
-        case irq_2:
+        MICRO(irq_2)
             
             IDLE_READ_IMPLIED
             CONTINUE
             
-        case irq_3:
+        MICRO(irq_3)
             
             PUSH_PCH
             CONTINUE
             
-        case irq_4:
+        MICRO(irq_4)
             
             PUSH_PCL
             // Check for interrupt hijacking
@@ -372,19 +399,19 @@ Peddle::execute()
             }
             CONTINUE
             
-        case irq_5:
+        MICRO(irq_5)
             
             write<C>(0x100+(reg.sp--), getPWithClearedB());
             CONTINUE
             
-        case irq_6:
+        MICRO(irq_6)
             
             READ_FROM(0xFFFE)
             SET_PCL(reg.d);
             setI(1);
             CONTINUE
             
-        case irq_7:
+        MICRO(irq_7)
             
             READ_FROM(0xFFFF)
             SET_PCH(reg.d);
@@ -395,34 +422,34 @@ Peddle::execute()
             // NMI handling
             //
 
-        case nmi_2:
+        MICRO(nmi_2)
 
             IDLE_READ_IMPLIED
             CONTINUE
             
-        case nmi_3:
+        MICRO(nmi_3)
             
             PUSH_PCH
             CONTINUE
             
-        case nmi_4:
+        MICRO(nmi_4)
             
             PUSH_PCL
             CONTINUE
             
-        case nmi_5:
+        MICRO(nmi_5)
             
             write<C>(0x100+(reg.sp--), getPWithClearedB());
             CONTINUE
             
-        case nmi_6:
+        MICRO(nmi_6)
             
             READ_FROM(0xFFFA)
             SET_PCL(reg.d);
             setI(1);
             CONTINUE
             
-        case nmi_7:
+        MICRO(nmi_7)
 
             READ_FROM(0xFFFB)
             SET_PCH(reg.d);
@@ -433,7 +460,7 @@ Peddle::execute()
             // Adressing mode: Immediate (shared behavior)
             //
 
-        case BRK: case RTI: case RTS:
+        MICRO(BRK) MICRO(RTI) MICRO(RTS)
             
             IDLE_READ_IMMEDIATE
             CONTINUE
@@ -442,7 +469,7 @@ Peddle::execute()
             // Adressing mode: Implied (shared behavior)
             //
 
-        case PHA: case PHP: case PLA: case PLP:
+        MICRO(PHA) MICRO(PHP) MICRO(PLA) MICRO(PLP)
             
             IDLE_READ_IMPLIED
             CONTINUE
@@ -451,21 +478,21 @@ Peddle::execute()
             // Adressing mode: Zero-Page  (shared behavior)
             //
 
-        case ADC_zpg: case AND_zpg: case ASL_zpg: case BIT_zpg:
-        case CMP_zpg: case CPX_zpg: case CPY_zpg: case DEC_zpg:
-        case EOR_zpg: case INC_zpg: case LDA_zpg: case LDX_zpg:
-        case LDY_zpg: case LSR_zpg: case NOP_zpg: case ORA_zpg:
-        case ROL_zpg: case ROR_zpg: case SBC_zpg: case STA_zpg:
-        case STX_zpg: case STY_zpg: case DCP_zpg: case ISC_zpg:
-        case LAX_zpg: case RLA_zpg: case RRA_zpg: case SAX_zpg:
-        case SLO_zpg: case SRE_zpg:
+        MICRO(ADC_zpg) MICRO(AND_zpg) MICRO(ASL_zpg) MICRO(BIT_zpg)
+        MICRO(CMP_zpg) MICRO(CPX_zpg) MICRO(CPY_zpg) MICRO(DEC_zpg)
+        MICRO(EOR_zpg) MICRO(INC_zpg) MICRO(LDA_zpg) MICRO(LDX_zpg)
+        MICRO(LDY_zpg) MICRO(LSR_zpg) MICRO(NOP_zpg) MICRO(ORA_zpg)
+        MICRO(ROL_zpg) MICRO(ROR_zpg) MICRO(SBC_zpg) MICRO(STA_zpg)
+        MICRO(STX_zpg) MICRO(STY_zpg) MICRO(DCP_zpg) MICRO(ISC_zpg)
+        MICRO(LAX_zpg) MICRO(RLA_zpg) MICRO(RRA_zpg) MICRO(SAX_zpg)
+        MICRO(SLO_zpg) MICRO(SRE_zpg)
             
             FETCH_ADDR_LO
             CONTINUE
             
-        case ASL_zpg_2: case DEC_zpg_2: case INC_zpg_2: case LSR_zpg_2:
-        case ROL_zpg_2: case ROR_zpg_2: case DCP_zpg_2: case ISC_zpg_2:
-        case RLA_zpg_2: case RRA_zpg_2: case SLO_zpg_2: case SRE_zpg_2:
+        MICRO(ASL_zpg_2) MICRO(DEC_zpg_2) MICRO(INC_zpg_2) MICRO(LSR_zpg_2)
+        MICRO(ROL_zpg_2) MICRO(ROR_zpg_2) MICRO(DCP_zpg_2) MICRO(ISC_zpg_2)
+        MICRO(RLA_zpg_2) MICRO(RRA_zpg_2) MICRO(SLO_zpg_2) MICRO(SRE_zpg_2)
             
             READ_FROM_ZERO_PAGE
             CONTINUE
@@ -474,38 +501,38 @@ Peddle::execute()
             // Adressing mode: Zero-Page Indexed (shared behavior)
             //
             
-        case ADC_zpg_x: case AND_zpg_x: case ASL_zpg_x: case CMP_zpg_x:
-        case DEC_zpg_x: case EOR_zpg_x: case INC_zpg_x: case LDA_zpg_x:
-        case LDY_zpg_x: case LSR_zpg_x: case NOP_zpg_x: case ORA_zpg_x:
-        case ROL_zpg_x: case ROR_zpg_x: case SBC_zpg_x: case STA_zpg_x:
-        case STY_zpg_x: case DCP_zpg_x: case ISC_zpg_x: case RLA_zpg_x:
-        case RRA_zpg_x: case SLO_zpg_x: case SRE_zpg_x:
+        MICRO(ADC_zpg_x) MICRO(AND_zpg_x) MICRO(ASL_zpg_x) MICRO(CMP_zpg_x)
+        MICRO(DEC_zpg_x) MICRO(EOR_zpg_x) MICRO(INC_zpg_x) MICRO(LDA_zpg_x)
+        MICRO(LDY_zpg_x) MICRO(LSR_zpg_x) MICRO(NOP_zpg_x) MICRO(ORA_zpg_x)
+        MICRO(ROL_zpg_x) MICRO(ROR_zpg_x) MICRO(SBC_zpg_x) MICRO(STA_zpg_x)
+        MICRO(STY_zpg_x) MICRO(DCP_zpg_x) MICRO(ISC_zpg_x) MICRO(RLA_zpg_x)
+        MICRO(RRA_zpg_x) MICRO(SLO_zpg_x) MICRO(SRE_zpg_x)
 
-        case LDX_zpg_y: case STX_zpg_y: case LAX_zpg_y: case SAX_zpg_y:
+        MICRO(LDX_zpg_y) MICRO(STX_zpg_y) MICRO(LAX_zpg_y) MICRO(SAX_zpg_y)
             
             FETCH_ADDR_LO
             CONTINUE
 
-        case ADC_zpg_x_2: case AND_zpg_x_2: case ASL_zpg_x_2: case CMP_zpg_x_2:
-        case DEC_zpg_x_2: case EOR_zpg_x_2: case INC_zpg_x_2: case LDA_zpg_x_2:
-        case LDY_zpg_x_2: case LSR_zpg_x_2: case NOP_zpg_x_2: case ORA_zpg_x_2:
-        case ROL_zpg_x_2: case ROR_zpg_x_2: case SBC_zpg_x_2: case DCP_zpg_x_2:
-        case ISC_zpg_x_2: case RLA_zpg_x_2: case RRA_zpg_x_2: case SLO_zpg_x_2:
-        case SRE_zpg_x_2: case STA_zpg_x_2: case STY_zpg_x_2:
+        MICRO(ADC_zpg_x_2) MICRO(AND_zpg_x_2) MICRO(ASL_zpg_x_2) MICRO(CMP_zpg_x_2)
+        MICRO(DEC_zpg_x_2) MICRO(EOR_zpg_x_2) MICRO(INC_zpg_x_2) MICRO(LDA_zpg_x_2)
+        MICRO(LDY_zpg_x_2) MICRO(LSR_zpg_x_2) MICRO(NOP_zpg_x_2) MICRO(ORA_zpg_x_2)
+        MICRO(ROL_zpg_x_2) MICRO(ROR_zpg_x_2) MICRO(SBC_zpg_x_2) MICRO(DCP_zpg_x_2)
+        MICRO(ISC_zpg_x_2) MICRO(RLA_zpg_x_2) MICRO(RRA_zpg_x_2) MICRO(SLO_zpg_x_2)
+        MICRO(SRE_zpg_x_2) MICRO(STA_zpg_x_2) MICRO(STY_zpg_x_2)
             
             READ_FROM_ZERO_PAGE
             ADD_INDEX_X
             CONTINUE
 
-        case LDX_zpg_y_2: case LAX_zpg_y_2: case STX_zpg_y_2: case SAX_zpg_y_2:
+        MICRO(LDX_zpg_y_2) MICRO(LAX_zpg_y_2) MICRO(STX_zpg_y_2) MICRO(SAX_zpg_y_2)
             
             READ_FROM_ZERO_PAGE
             ADD_INDEX_Y
             CONTINUE
 
-        case ASL_zpg_x_3: case DEC_zpg_x_3: case INC_zpg_x_3: case LSR_zpg_x_3:
-        case ROL_zpg_x_3: case ROR_zpg_x_3: case DCP_zpg_x_3: case ISC_zpg_x_3:
-        case RLA_zpg_x_3: case RRA_zpg_x_3: case SLO_zpg_x_3: case SRE_zpg_x_3:
+        MICRO(ASL_zpg_x_3) MICRO(DEC_zpg_x_3) MICRO(INC_zpg_x_3) MICRO(LSR_zpg_x_3)
+        MICRO(ROL_zpg_x_3) MICRO(ROR_zpg_x_3) MICRO(DCP_zpg_x_3) MICRO(ISC_zpg_x_3)
+        MICRO(RLA_zpg_x_3) MICRO(RRA_zpg_x_3) MICRO(SLO_zpg_x_3) MICRO(SRE_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             CONTINUE
@@ -515,33 +542,33 @@ Peddle::execute()
             // Adressing mode: Absolute (shared behavior)
             //
             
-        case ADC_abs: case AND_abs: case ASL_abs: case BIT_abs:
-        case CMP_abs: case CPX_abs: case CPY_abs: case DEC_abs:
-        case EOR_abs: case INC_abs: case LDA_abs: case LDX_abs:
-        case LDY_abs: case LSR_abs: case NOP_abs: case ORA_abs:
-        case ROL_abs: case ROR_abs: case SBC_abs: case STA_abs:
-        case STX_abs: case STY_abs: case DCP_abs: case ISC_abs:
-        case LAX_abs: case RLA_abs: case RRA_abs: case SAX_abs:
-        case SLO_abs: case SRE_abs:
+        MICRO(ADC_abs) MICRO(AND_abs) MICRO(ASL_abs) MICRO(BIT_abs)
+        MICRO(CMP_abs) MICRO(CPX_abs) MICRO(CPY_abs) MICRO(DEC_abs)
+        MICRO(EOR_abs) MICRO(INC_abs) MICRO(LDA_abs) MICRO(LDX_abs)
+        MICRO(LDY_abs) MICRO(LSR_abs) MICRO(NOP_abs) MICRO(ORA_abs)
+        MICRO(ROL_abs) MICRO(ROR_abs) MICRO(SBC_abs) MICRO(STA_abs)
+        MICRO(STX_abs) MICRO(STY_abs) MICRO(DCP_abs) MICRO(ISC_abs)
+        MICRO(LAX_abs) MICRO(RLA_abs) MICRO(RRA_abs) MICRO(SAX_abs)
+        MICRO(SLO_abs) MICRO(SRE_abs)
             
             FETCH_ADDR_LO
             CONTINUE
 
-        case ADC_abs_2: case AND_abs_2: case ASL_abs_2: case BIT_abs_2:
-        case CMP_abs_2: case CPX_abs_2: case CPY_abs_2: case DEC_abs_2:
-        case EOR_abs_2: case INC_abs_2: case LDA_abs_2: case LDX_abs_2:
-        case LDY_abs_2: case LSR_abs_2: case NOP_abs_2: case ORA_abs_2:
-        case ROL_abs_2: case ROR_abs_2: case SBC_abs_2: case STA_abs_2:
-        case STX_abs_2: case STY_abs_2: case DCP_abs_2: case ISC_abs_2:
-        case LAX_abs_2: case RLA_abs_2: case RRA_abs_2: case SAX_abs_2:
-        case SLO_abs_2: case SRE_abs_2:
+        MICRO(ADC_abs_2) MICRO(AND_abs_2) MICRO(ASL_abs_2) MICRO(BIT_abs_2)
+        MICRO(CMP_abs_2) MICRO(CPX_abs_2) MICRO(CPY_abs_2) MICRO(DEC_abs_2)
+        MICRO(EOR_abs_2) MICRO(INC_abs_2) MICRO(LDA_abs_2) MICRO(LDX_abs_2)
+        MICRO(LDY_abs_2) MICRO(LSR_abs_2) MICRO(NOP_abs_2) MICRO(ORA_abs_2)
+        MICRO(ROL_abs_2) MICRO(ROR_abs_2) MICRO(SBC_abs_2) MICRO(STA_abs_2)
+        MICRO(STX_abs_2) MICRO(STY_abs_2) MICRO(DCP_abs_2) MICRO(ISC_abs_2)
+        MICRO(LAX_abs_2) MICRO(RLA_abs_2) MICRO(RRA_abs_2) MICRO(SAX_abs_2)
+        MICRO(SLO_abs_2) MICRO(SRE_abs_2)
             
             FETCH_ADDR_HI
             CONTINUE
             
-        case ASL_abs_3: case DEC_abs_3: case INC_abs_3: case LSR_abs_3:
-        case ROL_abs_3: case ROR_abs_3: case DCP_abs_3: case ISC_abs_3:
-        case RLA_abs_3: case RRA_abs_3: case SLO_abs_3: case SRE_abs_3:
+        MICRO(ASL_abs_3) MICRO(DEC_abs_3) MICRO(INC_abs_3) MICRO(LSR_abs_3)
+        MICRO(ROL_abs_3) MICRO(ROR_abs_3) MICRO(DCP_abs_3) MICRO(ISC_abs_3)
+        MICRO(RLA_abs_3) MICRO(RRA_abs_3) MICRO(SLO_abs_3) MICRO(SRE_abs_3)
             
             READ_FROM_ADDRESS
             CONTINUE
@@ -550,63 +577,63 @@ Peddle::execute()
             // Adressing mode: Absolute Indexed (shared behavior)
             //
             
-        case ADC_abs_x: case AND_abs_x: case ASL_abs_x: case CMP_abs_x:
-        case DEC_abs_x: case EOR_abs_x: case INC_abs_x: case LDA_abs_x:
-        case LDY_abs_x: case LSR_abs_x: case NOP_abs_x: case ORA_abs_x:
-        case ROL_abs_x: case ROR_abs_x: case SBC_abs_x: case STA_abs_x:
-        case DCP_abs_x: case ISC_abs_x: case RLA_abs_x: case RRA_abs_x:
-        case SHY_abs_x: case SLO_abs_x: case SRE_abs_x:
+        MICRO(ADC_abs_x) MICRO(AND_abs_x) MICRO(ASL_abs_x) MICRO(CMP_abs_x)
+        MICRO(DEC_abs_x) MICRO(EOR_abs_x) MICRO(INC_abs_x) MICRO(LDA_abs_x)
+        MICRO(LDY_abs_x) MICRO(LSR_abs_x) MICRO(NOP_abs_x) MICRO(ORA_abs_x)
+        MICRO(ROL_abs_x) MICRO(ROR_abs_x) MICRO(SBC_abs_x) MICRO(STA_abs_x)
+        MICRO(DCP_abs_x) MICRO(ISC_abs_x) MICRO(RLA_abs_x) MICRO(RRA_abs_x)
+        MICRO(SHY_abs_x) MICRO(SLO_abs_x) MICRO(SRE_abs_x)
             
-        case ADC_abs_y: case AND_abs_y: case CMP_abs_y: case EOR_abs_y:
-        case LDA_abs_y: case LDX_abs_y: case LSR_abs_y: case ORA_abs_y:
-        case SBC_abs_y: case STA_abs_y: case DCP_abs_y: case ISC_abs_y:
-        case LAS_abs_y: case LAX_abs_y: case RLA_abs_y: case RRA_abs_y:
-        case SHA_abs_y: case SHX_abs_y: case SLO_abs_y: case SRE_abs_y:
-        case TAS_abs_y:
+        MICRO(ADC_abs_y) MICRO(AND_abs_y) MICRO(CMP_abs_y) MICRO(EOR_abs_y)
+        MICRO(LDA_abs_y) MICRO(LDX_abs_y) MICRO(LSR_abs_y) MICRO(ORA_abs_y)
+        MICRO(SBC_abs_y) MICRO(STA_abs_y) MICRO(DCP_abs_y) MICRO(ISC_abs_y)
+        MICRO(LAS_abs_y) MICRO(LAX_abs_y) MICRO(RLA_abs_y) MICRO(RRA_abs_y)
+        MICRO(SHA_abs_y) MICRO(SHX_abs_y) MICRO(SLO_abs_y) MICRO(SRE_abs_y)
+        MICRO(TAS_abs_y)
             
             FETCH_ADDR_LO
             CONTINUE
             
-        case ADC_abs_x_2: case AND_abs_x_2: case ASL_abs_x_2: case CMP_abs_x_2:
-        case DEC_abs_x_2: case EOR_abs_x_2: case INC_abs_x_2: case LDA_abs_x_2:
-        case LDY_abs_x_2: case LSR_abs_x_2: case NOP_abs_x_2: case ORA_abs_x_2:
-        case ROL_abs_x_2: case ROR_abs_x_2: case SBC_abs_x_2: case STA_abs_x_2:
-        case DCP_abs_x_2: case ISC_abs_x_2: case RLA_abs_x_2: case RRA_abs_x_2:
-        case SHY_abs_x_2: case SLO_abs_x_2: case SRE_abs_x_2:
+        MICRO(ADC_abs_x_2) MICRO(AND_abs_x_2) MICRO(ASL_abs_x_2) MICRO(CMP_abs_x_2)
+        MICRO(DEC_abs_x_2) MICRO(EOR_abs_x_2) MICRO(INC_abs_x_2) MICRO(LDA_abs_x_2)
+        MICRO(LDY_abs_x_2) MICRO(LSR_abs_x_2) MICRO(NOP_abs_x_2) MICRO(ORA_abs_x_2)
+        MICRO(ROL_abs_x_2) MICRO(ROR_abs_x_2) MICRO(SBC_abs_x_2) MICRO(STA_abs_x_2)
+        MICRO(DCP_abs_x_2) MICRO(ISC_abs_x_2) MICRO(RLA_abs_x_2) MICRO(RRA_abs_x_2)
+        MICRO(SHY_abs_x_2) MICRO(SLO_abs_x_2) MICRO(SRE_abs_x_2)
             
             FETCH_ADDR_HI
             ADD_INDEX_X
             CONTINUE
             
-        case ADC_abs_y_2: case AND_abs_y_2: case CMP_abs_y_2: case EOR_abs_y_2:
-        case LDA_abs_y_2: case LDX_abs_y_2: case LSR_abs_y_2: case ORA_abs_y_2:
-        case SBC_abs_y_2: case STA_abs_y_2: case DCP_abs_y_2: case ISC_abs_y_2:
-        case LAS_abs_y_2: case LAX_abs_y_2: case RLA_abs_y_2: case RRA_abs_y_2:
-        case SHA_abs_y_2: case SHX_abs_y_2: case SLO_abs_y_2: case SRE_abs_y_2:
-        case TAS_abs_y_2:
+        MICRO(ADC_abs_y_2) MICRO(AND_abs_y_2) MICRO(CMP_abs_y_2) MICRO(EOR_abs_y_2)
+        MICRO(LDA_abs_y_2) MICRO(LDX_abs_y_2) MICRO(LSR_abs_y_2) MICRO(ORA_abs_y_2)
+        MICRO(SBC_abs_y_2) MICRO(STA_abs_y_2) MICRO(DCP_abs_y_2) MICRO(ISC_abs_y_2)
+        MICRO(LAS_abs_y_2) MICRO(LAX_abs_y_2) MICRO(RLA_abs_y_2) MICRO(RRA_abs_y_2)
+        MICRO(SHA_abs_y_2) MICRO(SHX_abs_y_2) MICRO(SLO_abs_y_2) MICRO(SRE_abs_y_2)
+        MICRO(TAS_abs_y_2)
             
             FETCH_ADDR_HI
             ADD_INDEX_Y
             CONTINUE
             
-        case ASL_abs_x_3: case DEC_abs_x_3: case INC_abs_x_3: case LSR_abs_x_3:
-        case ROL_abs_x_3: case ROR_abs_x_3: case DCP_abs_x_3: case ISC_abs_x_3:
-        case RLA_abs_x_3: case RRA_abs_x_3: case STA_abs_x_3: case SLO_abs_x_3:
-        case SRE_abs_x_3:
+        MICRO(ASL_abs_x_3) MICRO(DEC_abs_x_3) MICRO(INC_abs_x_3) MICRO(LSR_abs_x_3)
+        MICRO(ROL_abs_x_3) MICRO(ROR_abs_x_3) MICRO(DCP_abs_x_3) MICRO(ISC_abs_x_3)
+        MICRO(RLA_abs_x_3) MICRO(RRA_abs_x_3) MICRO(STA_abs_x_3) MICRO(SLO_abs_x_3)
+        MICRO(SRE_abs_x_3)
 
-        case LSR_abs_y_3: case STA_abs_y_3: case DCP_abs_y_3: case ISC_abs_y_3:
-        case RLA_abs_y_3: case RRA_abs_y_3: case SLO_abs_y_3: case SRE_abs_y_3:
+        MICRO(LSR_abs_y_3) MICRO(STA_abs_y_3) MICRO(DCP_abs_y_3) MICRO(ISC_abs_y_3)
+        MICRO(RLA_abs_y_3) MICRO(RRA_abs_y_3) MICRO(SLO_abs_y_3) MICRO(SRE_abs_y_3)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) { FIX_ADDR_HI }
             CONTINUE
             
-        case ASL_abs_x_4: case DEC_abs_x_4: case INC_abs_x_4: case LSR_abs_x_4:
-        case ROL_abs_x_4: case ROR_abs_x_4: case DCP_abs_x_4: case ISC_abs_x_4:
-        case RLA_abs_x_4: case RRA_abs_x_4: case SLO_abs_x_4: case SRE_abs_x_4:
+        MICRO(ASL_abs_x_4) MICRO(DEC_abs_x_4) MICRO(INC_abs_x_4) MICRO(LSR_abs_x_4)
+        MICRO(ROL_abs_x_4) MICRO(ROR_abs_x_4) MICRO(DCP_abs_x_4) MICRO(ISC_abs_x_4)
+        MICRO(RLA_abs_x_4) MICRO(RRA_abs_x_4) MICRO(SLO_abs_x_4) MICRO(SRE_abs_x_4)
             
-        case DCP_abs_y_4: case LSR_abs_y_4: case ISC_abs_y_4: case RLA_abs_y_4:
-        case RRA_abs_y_4: case SLO_abs_y_4: case SRE_abs_y_4:
+        MICRO(DCP_abs_y_4) MICRO(LSR_abs_y_4) MICRO(ISC_abs_y_4) MICRO(RLA_abs_y_4)
+        MICRO(RRA_abs_y_4) MICRO(SLO_abs_y_4) MICRO(SRE_abs_y_4)
             
             READ_FROM_ADDRESS
             CONTINUE
@@ -615,50 +642,50 @@ Peddle::execute()
             // Adressing mode: Indexed Indirect (shared behavior)
             //
 
-        case ADC_ind_x: case AND_ind_x: case ASL_ind_x: case CMP_ind_x:
-        case DEC_ind_x: case EOR_ind_x: case INC_ind_x: case LDA_ind_x:
-        case LDX_ind_x: case LDY_ind_x: case LSR_ind_x: case ORA_ind_x:
-        case ROL_ind_x: case ROR_ind_x: case SBC_ind_x: case STA_ind_x:
-        case DCP_ind_x: case ISC_ind_x: case LAX_ind_x: case RLA_ind_x:
-        case RRA_ind_x: case SAX_ind_x: case SLO_ind_x: case SRE_ind_x:
+        MICRO(ADC_ind_x) MICRO(AND_ind_x) MICRO(ASL_ind_x) MICRO(CMP_ind_x)
+        MICRO(DEC_ind_x) MICRO(EOR_ind_x) MICRO(INC_ind_x) MICRO(LDA_ind_x)
+        MICRO(LDX_ind_x) MICRO(LDY_ind_x) MICRO(LSR_ind_x) MICRO(ORA_ind_x)
+        MICRO(ROL_ind_x) MICRO(ROR_ind_x) MICRO(SBC_ind_x) MICRO(STA_ind_x)
+        MICRO(DCP_ind_x) MICRO(ISC_ind_x) MICRO(LAX_ind_x) MICRO(RLA_ind_x)
+        MICRO(RRA_ind_x) MICRO(SAX_ind_x) MICRO(SLO_ind_x) MICRO(SRE_ind_x)
             
             FETCH_POINTER_ADDR
             CONTINUE
             
-        case ADC_ind_x_2: case AND_ind_x_2: case ASL_ind_x_2: case CMP_ind_x_2:
-        case DEC_ind_x_2: case EOR_ind_x_2: case INC_ind_x_2: case LDA_ind_x_2:
-        case LDX_ind_x_2: case LDY_ind_x_2: case LSR_ind_x_2: case ORA_ind_x_2:
-        case ROL_ind_x_2: case ROR_ind_x_2: case SBC_ind_x_2: case STA_ind_x_2:
-        case DCP_ind_x_2: case ISC_ind_x_2: case LAX_ind_x_2: case RLA_ind_x_2:
-        case RRA_ind_x_2: case SAX_ind_x_2: case SLO_ind_x_2: case SRE_ind_x_2:
+        MICRO(ADC_ind_x_2) MICRO(AND_ind_x_2) MICRO(ASL_ind_x_2) MICRO(CMP_ind_x_2)
+        MICRO(DEC_ind_x_2) MICRO(EOR_ind_x_2) MICRO(INC_ind_x_2) MICRO(LDA_ind_x_2)
+        MICRO(LDX_ind_x_2) MICRO(LDY_ind_x_2) MICRO(LSR_ind_x_2) MICRO(ORA_ind_x_2)
+        MICRO(ROL_ind_x_2) MICRO(ROR_ind_x_2) MICRO(SBC_ind_x_2) MICRO(STA_ind_x_2)
+        MICRO(DCP_ind_x_2) MICRO(ISC_ind_x_2) MICRO(LAX_ind_x_2) MICRO(RLA_ind_x_2)
+        MICRO(RRA_ind_x_2) MICRO(SAX_ind_x_2) MICRO(SLO_ind_x_2) MICRO(SRE_ind_x_2)
             
             IDLE_READ_FROM_ADDRESS_INDIRECT
             ADD_INDEX_X_INDIRECT
             CONTINUE
             
-        case ADC_ind_x_3: case AND_ind_x_3: case ASL_ind_x_3: case CMP_ind_x_3:
-        case DEC_ind_x_3: case EOR_ind_x_3: case INC_ind_x_3: case LDA_ind_x_3:
-        case LDX_ind_x_3: case LDY_ind_x_3: case LSR_ind_x_3: case ORA_ind_x_3:
-        case ROL_ind_x_3: case ROR_ind_x_3: case SBC_ind_x_3: case STA_ind_x_3:
-        case DCP_ind_x_3: case ISC_ind_x_3: case LAX_ind_x_3: case RLA_ind_x_3:
-        case RRA_ind_x_3: case SAX_ind_x_3: case SLO_ind_x_3: case SRE_ind_x_3:
+        MICRO(ADC_ind_x_3) MICRO(AND_ind_x_3) MICRO(ASL_ind_x_3) MICRO(CMP_ind_x_3)
+        MICRO(DEC_ind_x_3) MICRO(EOR_ind_x_3) MICRO(INC_ind_x_3) MICRO(LDA_ind_x_3)
+        MICRO(LDX_ind_x_3) MICRO(LDY_ind_x_3) MICRO(LSR_ind_x_3) MICRO(ORA_ind_x_3)
+        MICRO(ROL_ind_x_3) MICRO(ROR_ind_x_3) MICRO(SBC_ind_x_3) MICRO(STA_ind_x_3)
+        MICRO(DCP_ind_x_3) MICRO(ISC_ind_x_3) MICRO(LAX_ind_x_3) MICRO(RLA_ind_x_3)
+        MICRO(RRA_ind_x_3) MICRO(SAX_ind_x_3) MICRO(SLO_ind_x_3) MICRO(SRE_ind_x_3)
             
             FETCH_ADDR_LO_INDIRECT
             CONTINUE
             
-        case ADC_ind_x_4: case AND_ind_x_4: case ASL_ind_x_4: case CMP_ind_x_4:
-        case DEC_ind_x_4: case EOR_ind_x_4: case INC_ind_x_4: case LDA_ind_x_4:
-        case LDX_ind_x_4: case LDY_ind_x_4: case LSR_ind_x_4: case ORA_ind_x_4:
-        case ROL_ind_x_4: case ROR_ind_x_4: case SBC_ind_x_4: case STA_ind_x_4:
-        case DCP_ind_x_4: case ISC_ind_x_4: case LAX_ind_x_4: case RLA_ind_x_4:
-        case RRA_ind_x_4: case SAX_ind_x_4: case SLO_ind_x_4: case SRE_ind_x_4:
+        MICRO(ADC_ind_x_4) MICRO(AND_ind_x_4) MICRO(ASL_ind_x_4) MICRO(CMP_ind_x_4)
+        MICRO(DEC_ind_x_4) MICRO(EOR_ind_x_4) MICRO(INC_ind_x_4) MICRO(LDA_ind_x_4)
+        MICRO(LDX_ind_x_4) MICRO(LDY_ind_x_4) MICRO(LSR_ind_x_4) MICRO(ORA_ind_x_4)
+        MICRO(ROL_ind_x_4) MICRO(ROR_ind_x_4) MICRO(SBC_ind_x_4) MICRO(STA_ind_x_4)
+        MICRO(DCP_ind_x_4) MICRO(ISC_ind_x_4) MICRO(LAX_ind_x_4) MICRO(RLA_ind_x_4)
+        MICRO(RRA_ind_x_4) MICRO(SAX_ind_x_4) MICRO(SLO_ind_x_4) MICRO(SRE_ind_x_4)
             
             FETCH_ADDR_HI_INDIRECT
             CONTINUE
             
-        case ASL_ind_x_5: case DEC_ind_x_5: case INC_ind_x_5: case LSR_ind_x_5:
-        case ROL_ind_x_5: case ROR_ind_x_5: case DCP_ind_x_5: case ISC_ind_x_5:
-        case RLA_ind_x_5: case RRA_ind_x_5: case SLO_ind_x_5: case SRE_ind_x_5:
+        MICRO(ASL_ind_x_5) MICRO(DEC_ind_x_5) MICRO(INC_ind_x_5) MICRO(LSR_ind_x_5)
+        MICRO(ROL_ind_x_5) MICRO(ROR_ind_x_5) MICRO(DCP_ind_x_5) MICRO(ISC_ind_x_5)
+        MICRO(RLA_ind_x_5) MICRO(RRA_ind_x_5) MICRO(SLO_ind_x_5) MICRO(SRE_ind_x_5)
             
             READ_FROM_ADDRESS
             CONTINUE
@@ -667,43 +694,43 @@ Peddle::execute()
             // Adressing mode: Indirect Indexed (shared behavior)
             //
             
-        case ADC_ind_y: case AND_ind_y: case CMP_ind_y: case EOR_ind_y:
-        case LDA_ind_y: case LDX_ind_y: case LDY_ind_y: case LSR_ind_y:
-        case ORA_ind_y: case SBC_ind_y: case STA_ind_y: case DCP_ind_y:
-        case ISC_ind_y: case LAX_ind_y: case RLA_ind_y: case RRA_ind_y:
-        case SHA_ind_y: case SLO_ind_y: case SRE_ind_y:
+        MICRO(ADC_ind_y) MICRO(AND_ind_y) MICRO(CMP_ind_y) MICRO(EOR_ind_y)
+        MICRO(LDA_ind_y) MICRO(LDX_ind_y) MICRO(LDY_ind_y) MICRO(LSR_ind_y)
+        MICRO(ORA_ind_y) MICRO(SBC_ind_y) MICRO(STA_ind_y) MICRO(DCP_ind_y)
+        MICRO(ISC_ind_y) MICRO(LAX_ind_y) MICRO(RLA_ind_y) MICRO(RRA_ind_y)
+        MICRO(SHA_ind_y) MICRO(SLO_ind_y) MICRO(SRE_ind_y)
             
             FETCH_POINTER_ADDR
             CONTINUE
 
-        case ADC_ind_y_2: case AND_ind_y_2: case CMP_ind_y_2: case EOR_ind_y_2:
-        case LDA_ind_y_2: case LDX_ind_y_2: case LDY_ind_y_2: case LSR_ind_y_2:
-        case ORA_ind_y_2: case SBC_ind_y_2: case STA_ind_y_2: case DCP_ind_y_2:
-        case ISC_ind_y_2: case LAX_ind_y_2: case RLA_ind_y_2: case RRA_ind_y_2:
-        case SHA_ind_y_2: case SLO_ind_y_2: case SRE_ind_y_2:
+        MICRO(ADC_ind_y_2) MICRO(AND_ind_y_2) MICRO(CMP_ind_y_2) MICRO(EOR_ind_y_2)
+        MICRO(LDA_ind_y_2) MICRO(LDX_ind_y_2) MICRO(LDY_ind_y_2) MICRO(LSR_ind_y_2)
+        MICRO(ORA_ind_y_2) MICRO(SBC_ind_y_2) MICRO(STA_ind_y_2) MICRO(DCP_ind_y_2)
+        MICRO(ISC_ind_y_2) MICRO(LAX_ind_y_2) MICRO(RLA_ind_y_2) MICRO(RRA_ind_y_2)
+        MICRO(SHA_ind_y_2) MICRO(SLO_ind_y_2) MICRO(SRE_ind_y_2)
             
             FETCH_ADDR_LO_INDIRECT
             CONTINUE
             
-        case ADC_ind_y_3: case AND_ind_y_3: case CMP_ind_y_3: case EOR_ind_y_3:
-        case LDA_ind_y_3: case LDX_ind_y_3: case LDY_ind_y_3: case LSR_ind_y_3:
-        case ORA_ind_y_3: case SBC_ind_y_3: case STA_ind_y_3: case DCP_ind_y_3:
-        case ISC_ind_y_3: case LAX_ind_y_3: case RLA_ind_y_3: case RRA_ind_y_3:
-        case SHA_ind_y_3: case SLO_ind_y_3: case SRE_ind_y_3:
+        MICRO(ADC_ind_y_3) MICRO(AND_ind_y_3) MICRO(CMP_ind_y_3) MICRO(EOR_ind_y_3)
+        MICRO(LDA_ind_y_3) MICRO(LDX_ind_y_3) MICRO(LDY_ind_y_3) MICRO(LSR_ind_y_3)
+        MICRO(ORA_ind_y_3) MICRO(SBC_ind_y_3) MICRO(STA_ind_y_3) MICRO(DCP_ind_y_3)
+        MICRO(ISC_ind_y_3) MICRO(LAX_ind_y_3) MICRO(RLA_ind_y_3) MICRO(RRA_ind_y_3)
+        MICRO(SHA_ind_y_3) MICRO(SLO_ind_y_3) MICRO(SRE_ind_y_3)
             
             FETCH_ADDR_HI_INDIRECT
             ADD_INDEX_Y
             CONTINUE
 
-        case LSR_ind_y_4: case STA_ind_y_4: case DCP_ind_y_4: case ISC_ind_y_4:
-        case RLA_ind_y_4: case RRA_ind_y_4: case SLO_ind_y_4: case SRE_ind_y_4:
+        MICRO(LSR_ind_y_4) MICRO(STA_ind_y_4) MICRO(DCP_ind_y_4) MICRO(ISC_ind_y_4)
+        MICRO(RLA_ind_y_4) MICRO(RRA_ind_y_4) MICRO(SLO_ind_y_4) MICRO(SRE_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) { FIX_ADDR_HI }
             CONTINUE
             
-        case LSR_ind_y_5: case DCP_ind_y_5: case ISC_ind_y_5: case RLA_ind_y_5:
-        case RRA_ind_y_5: case SLO_ind_y_5: case SRE_ind_y_5:
+        MICRO(LSR_ind_y_5) MICRO(DCP_ind_y_5) MICRO(ISC_ind_y_5) MICRO(RLA_ind_y_5)
+        MICRO(RRA_ind_y_5) MICRO(SLO_ind_y_5) MICRO(SRE_ind_y_5)
             
             READ_FROM_ADDRESS
             CONTINUE
@@ -712,8 +739,8 @@ Peddle::execute()
             // Adressing mode: Relative (shared behavior)
             //
             
-        case BCC_rel_2: case BCS_rel_2: case BEQ_rel_2: case BMI_rel_2:
-        case BNE_rel_2: case BPL_rel_2: case BVC_rel_2: case BVS_rel_2:
+        MICRO(BCC_rel_2) MICRO(BCS_rel_2) MICRO(BEQ_rel_2) MICRO(BMI_rel_2)
+        MICRO(BNE_rel_2) MICRO(BPL_rel_2) MICRO(BVC_rel_2) MICRO(BVS_rel_2)
         {
             IDLE_READ_IMPLIED
             u8 pc_hi = HI_BYTE(reg.pc);
@@ -726,13 +753,13 @@ Peddle::execute()
             DONE
         }
             
-        case branch_3_underflow:
+        MICRO(branch_3_underflow)
             
             IDLE_READ_FROM(reg.pc + 0x100)
             POLL_INT_AGAIN
             DONE
             
-        case branch_3_overflow:
+        MICRO(branch_3_overflow)
             
             IDLE_READ_FROM(reg.pc - 0x100)
             POLL_INT_AGAIN
@@ -746,24 +773,24 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - /
 
-        case ADC_imm:
+        MICRO(ADC_imm)
 
             READ_IMMEDIATE
             adc(reg.d);
             POLL_INT
             DONE
 
-        case ADC_zpg_2:
-        case ADC_zpg_x_3:
+        MICRO(ADC_zpg_2)
+        MICRO(ADC_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             adc(reg.d);
             POLL_INT
             DONE
 
-        case ADC_abs_x_3:
-        case ADC_abs_y_3:
-        case ADC_ind_y_4:
+        MICRO(ADC_abs_x_3)
+        MICRO(ADC_abs_y_3)
+        MICRO(ADC_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -775,11 +802,11 @@ Peddle::execute()
                 DONE
             }
             
-        case ADC_abs_3:
-        case ADC_abs_x_4:
-        case ADC_abs_y_4:
-        case ADC_ind_x_5:
-        case ADC_ind_y_5:
+        MICRO(ADC_abs_3)
+        MICRO(ADC_abs_x_4)
+        MICRO(ADC_abs_y_4)
+        MICRO(ADC_ind_x_5)
+        MICRO(ADC_ind_y_5)
             
             READ_FROM_ADDRESS
             adc(reg.d);
@@ -794,24 +821,24 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case AND_imm:
+        MICRO(AND_imm)
             
             READ_IMMEDIATE
             loadA(reg.a & reg.d);
             POLL_INT
             DONE
 
-        case AND_zpg_2:
-        case AND_zpg_x_3:
+        MICRO(AND_zpg_2)
+        MICRO(AND_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             loadA(reg.a & reg.d);
             POLL_INT
             DONE
             
-        case AND_abs_x_3:
-        case AND_abs_y_3:
-        case AND_ind_y_4:
+        MICRO(AND_abs_x_3)
+        MICRO(AND_abs_y_3)
+        MICRO(AND_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -823,11 +850,11 @@ Peddle::execute()
                 DONE
             }
             
-        case AND_abs_3:
-        case AND_abs_x_4:
-        case AND_abs_y_4:
-        case AND_ind_x_5:
-        case AND_ind_y_5:
+        MICRO(AND_abs_3)
+        MICRO(AND_abs_x_4)
+        MICRO(AND_abs_y_4)
+        MICRO(AND_ind_x_5)
+        MICRO(AND_ind_y_5)
             
             READ_FROM_ADDRESS
             loadA(reg.a & reg.d);
@@ -845,38 +872,38 @@ Peddle::execute()
 #define DO_ASL_ACC setC(reg.a & 0x80); loadA((u8)(reg.a << 1));
 #define DO_ASL setC(reg.d & 0x80); reg.d = (u8)(reg.d << 1);
 
-        case ASL_acc:
+        MICRO(ASL_acc)
             
             IDLE_READ_IMPLIED
             DO_ASL_ACC
             POLL_INT
             DONE
             
-        case ASL_zpg_3:
-        case ASL_zpg_x_4:
+        MICRO(ASL_zpg_3)
+        MICRO(ASL_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_ASL
             CONTINUE
 
-        case ASL_abs_4:
-        case ASL_abs_x_5:
-        case ASL_ind_x_6:
+        MICRO(ASL_abs_4)
+        MICRO(ASL_abs_x_5)
+        MICRO(ASL_ind_x_6)
             
             WRITE_TO_ADDRESS
             DO_ASL
             CONTINUE
             
-        case ASL_zpg_4:
-        case ASL_zpg_x_5:
+        MICRO(ASL_zpg_4)
+        MICRO(ASL_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
             POLL_INT
             DONE
             
-        case ASL_abs_5:
-        case ASL_abs_x_6:
-        case ASL_ind_x_7:
+        MICRO(ASL_abs_5)
+        MICRO(ASL_abs_x_6)
+        MICRO(ASL_ind_x_7)
             
             WRITE_TO_ADDRESS_AND_SET_FLAGS
             POLL_INT
@@ -890,7 +917,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case BCC_rel:
+        MICRO(BCC_rel)
             
             READ_IMMEDIATE
             POLL_INT
@@ -909,7 +936,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case BCS_rel:
+        MICRO(BCS_rel)
             
             READ_IMMEDIATE
             POLL_INT
@@ -928,7 +955,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case BEQ_rel:
+        MICRO(BEQ_rel)
             
             READ_IMMEDIATE
             POLL_INT
@@ -947,7 +974,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - /
             
-        case BIT_zpg_2:
+        MICRO(BIT_zpg_2)
             
             READ_FROM_ZERO_PAGE
             setN(reg.d & 128);
@@ -956,7 +983,7 @@ Peddle::execute()
             POLL_INT
             DONE
 
-        case BIT_abs_3:
+        MICRO(BIT_abs_3)
             
             READ_FROM_ADDRESS
             setN(reg.d & 128);
@@ -973,7 +1000,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case BMI_rel:
+        MICRO(BMI_rel)
             
             READ_IMMEDIATE
             POLL_INT
@@ -992,7 +1019,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case BNE_rel:
+        MICRO(BNE_rel)
             
             READ_IMMEDIATE
             POLL_INT
@@ -1011,7 +1038,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case BPL_rel:
+        MICRO(BPL_rel)
             
             READ_IMMEDIATE
             POLL_INT
@@ -1030,13 +1057,13 @@ Peddle::execute()
             // Flags:       N Z C I D V    B
             //              - - - 1 - -    1
             
-        case BRK_2:
+        MICRO(BRK_2)
             
             setB(1);
             PUSH_PCH
             CONTINUE
             
-        case BRK_3:
+        MICRO(BRK_3)
 
             PUSH_PCL
             
@@ -1053,19 +1080,19 @@ Peddle::execute()
                 CONTINUE
             }
             
-        case BRK_4:
+        MICRO(BRK_4)
             
             PUSH_P
             CONTINUE
             
-        case BRK_5:
+        MICRO(BRK_5)
             
             READ_FROM(0xFFFE);
             SET_PCL(reg.d);
             setI(1);
             CONTINUE
             
-        case BRK_6:
+        MICRO(BRK_6)
             
             READ_FROM(0xFFFF);
             SET_PCH(reg.d);
@@ -1075,19 +1102,19 @@ Peddle::execute()
             // after a BRK command, but not NMIs.
             DONE
             
-        case BRK_nmi_4:
+        MICRO(BRK_nmi_4)
             
             PUSH_P
             CONTINUE
             
-        case BRK_nmi_5:
+        MICRO(BRK_nmi_5)
             
             READ_FROM(0xFFFA);
             SET_PCL(reg.d);
             setI(1);
             CONTINUE
             
-        case BRK_nmi_6:
+        MICRO(BRK_nmi_6)
             
             READ_FROM(0xFFFB);
             SET_PCH(reg.d);
@@ -1102,7 +1129,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case BVC_rel:
+        MICRO(BVC_rel)
             
             READ_IMMEDIATE
             POLL_INT
@@ -1121,7 +1148,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case BVS_rel:
+        MICRO(BVS_rel)
             
             READ_IMMEDIATE
             POLL_INT
@@ -1140,7 +1167,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - 0 - - -
 
-        case CLC:
+        MICRO(CLC)
             
             IDLE_READ_IMPLIED
             setC(0);
@@ -1155,7 +1182,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - 0 -
 
-        case CLD:
+        MICRO(CLD)
             
             IDLE_READ_IMPLIED
             setD(0);
@@ -1170,7 +1197,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - 0 - -
 
-        case CLI:
+        MICRO(CLI)
             
             POLL_INT
             setI(0);
@@ -1185,7 +1212,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - 0
 
-        case CLV:
+        MICRO(CLV)
             
             IDLE_READ_IMPLIED
             setV(0);
@@ -1200,24 +1227,24 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - -
 
-        case CMP_imm:
+        MICRO(CMP_imm)
             
             READ_IMMEDIATE
             cmp(reg.a, reg.d);
             POLL_INT
             DONE
 
-        case CMP_zpg_2:
-        case CMP_zpg_x_3:
+        MICRO(CMP_zpg_2)
+        MICRO(CMP_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             cmp(reg.a, reg.d);
             POLL_INT
             DONE
 
-        case CMP_abs_x_3:
-        case CMP_abs_y_3:
-        case CMP_ind_y_4:
+        MICRO(CMP_abs_x_3)
+        MICRO(CMP_abs_y_3)
+        MICRO(CMP_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -1229,11 +1256,11 @@ Peddle::execute()
                 DONE
             }
             
-        case CMP_abs_3:
-        case CMP_abs_x_4:
-        case CMP_abs_y_4:
-        case CMP_ind_x_5:
-        case CMP_ind_y_5:
+        MICRO(CMP_abs_3)
+        MICRO(CMP_abs_x_4)
+        MICRO(CMP_abs_y_4)
+        MICRO(CMP_ind_x_5)
+        MICRO(CMP_ind_y_5)
             
             READ_FROM_ADDRESS
             cmp(reg.a, reg.d);
@@ -1248,21 +1275,21 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - -
 
-        case CPX_imm:
+        MICRO(CPX_imm)
             
             READ_IMMEDIATE
             cmp(reg.x, reg.d);
             POLL_INT
             DONE
             
-        case CPX_zpg_2:
+        MICRO(CPX_zpg_2)
             
             READ_FROM_ZERO_PAGE
             cmp(reg.x, reg.d);
             POLL_INT
             DONE
             
-        case CPX_abs_3:
+        MICRO(CPX_abs_3)
             
             READ_FROM_ADDRESS
             cmp(reg.x, reg.d);
@@ -1277,21 +1304,21 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - -
 
-        case CPY_imm:
+        MICRO(CPY_imm)
             
             READ_IMMEDIATE
             cmp(reg.y, reg.d);
             POLL_INT
             DONE
 
-        case CPY_zpg_2:
+        MICRO(CPY_zpg_2)
             
             READ_FROM_ZERO_PAGE
             cmp(reg.y, reg.d);
             POLL_INT
             DONE
 
-        case CPY_abs_3:
+        MICRO(CPY_abs_3)
             
             READ_FROM_ADDRESS
             cmp(reg.y, reg.d);
@@ -1308,31 +1335,31 @@ Peddle::execute()
             
 #define DO_DEC reg.d--;
             
-        case DEC_zpg_3:
-        case DEC_zpg_x_4:
+        MICRO(DEC_zpg_3)
+        MICRO(DEC_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_DEC
             CONTINUE
             
-        case DEC_zpg_4:
-        case DEC_zpg_x_5:
+        MICRO(DEC_zpg_4)
+        MICRO(DEC_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
             POLL_INT
             DONE
             
-        case DEC_abs_4:
-        case DEC_abs_x_5:
-        case DEC_ind_x_6:
+        MICRO(DEC_abs_4)
+        MICRO(DEC_abs_x_5)
+        MICRO(DEC_ind_x_6)
             
             WRITE_TO_ADDRESS
             DO_DEC
             CONTINUE
             
-        case DEC_abs_5:
-        case DEC_abs_x_6:
-        case DEC_ind_x_7:
+        MICRO(DEC_abs_5)
+        MICRO(DEC_abs_x_6)
+        MICRO(DEC_ind_x_7)
             
             WRITE_TO_ADDRESS_AND_SET_FLAGS
             POLL_INT
@@ -1346,7 +1373,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case DEX:
+        MICRO(DEX)
             
             IDLE_READ_IMPLIED
             loadX(reg.x - 1);
@@ -1361,7 +1388,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case DEY:
+        MICRO(DEY)
             
             IDLE_READ_IMPLIED
             loadY(reg.y - 1);
@@ -1378,24 +1405,24 @@ Peddle::execute()
 
 #define DO_EOR loadA(reg.a ^ reg.d);
             
-        case EOR_imm:
+        MICRO(EOR_imm)
             
             READ_IMMEDIATE
             DO_EOR
             POLL_INT
             DONE
             
-        case EOR_zpg_2:
-        case EOR_zpg_x_3:
+        MICRO(EOR_zpg_2)
+        MICRO(EOR_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             DO_EOR
             POLL_INT
             DONE
             
-        case EOR_abs_x_3:
-        case EOR_abs_y_3:
-        case EOR_ind_y_4:
+        MICRO(EOR_abs_x_3)
+        MICRO(EOR_abs_y_3)
+        MICRO(EOR_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -1407,11 +1434,11 @@ Peddle::execute()
                 DONE
             }
 
-        case EOR_abs_3:
-        case EOR_abs_x_4:
-        case EOR_abs_y_4:
-        case EOR_ind_x_5:
-        case EOR_ind_y_5:
+        MICRO(EOR_abs_3)
+        MICRO(EOR_abs_x_4)
+        MICRO(EOR_abs_y_4)
+        MICRO(EOR_ind_x_5)
+        MICRO(EOR_ind_y_5)
             
             READ_FROM_ADDRESS
             DO_EOR
@@ -1428,31 +1455,31 @@ Peddle::execute()
             
 #define DO_INC reg.d++;
             
-        case INC_zpg_3:
-        case INC_zpg_x_4:
+        MICRO(INC_zpg_3)
+        MICRO(INC_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_INC
             CONTINUE
             
-        case INC_zpg_4:
-        case INC_zpg_x_5:
+        MICRO(INC_zpg_4)
+        MICRO(INC_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
             POLL_INT
             DONE
 
-        case INC_abs_4:
-        case INC_abs_x_5:
-        case INC_ind_x_6:
+        MICRO(INC_abs_4)
+        MICRO(INC_abs_x_5)
+        MICRO(INC_ind_x_6)
             
             WRITE_TO_ADDRESS
             DO_INC
             CONTINUE
             
-        case INC_abs_5:
-        case INC_abs_x_6:
-        case INC_ind_x_7:
+        MICRO(INC_abs_5)
+        MICRO(INC_abs_x_6)
+        MICRO(INC_ind_x_7)
             
             WRITE_TO_ADDRESS_AND_SET_FLAGS
             POLL_INT
@@ -1466,7 +1493,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case INX:
+        MICRO(INX)
             
             IDLE_READ_IMPLIED
             loadX(reg.x + 1);
@@ -1481,7 +1508,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case INY:
+        MICRO(INY)
             
             IDLE_READ_IMPLIED
             loadY(reg.y + 1);
@@ -1496,36 +1523,36 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case JMP_abs:
+        MICRO(JMP_abs)
             
             FETCH_ADDR_LO
             CONTINUE
             
-        case JMP_abs_2:
+        MICRO(JMP_abs_2)
             
             FETCH_ADDR_HI
             reg.pc = LO_HI(reg.adl, reg.adh);
             POLL_INT
             DONE
 
-        case JMP_abs_ind:
+        MICRO(JMP_abs_ind)
             
             FETCH_ADDR_LO
             CONTINUE
             
-        case JMP_abs_ind_2:
+        MICRO(JMP_abs_ind_2)
             
             FETCH_ADDR_HI
             CONTINUE
             
-        case JMP_abs_ind_3:
+        MICRO(JMP_abs_ind_3)
             
             READ_FROM_ADDRESS
             SET_PCL(reg.d);
             reg.adl++;
             CONTINUE
             
-        case JMP_abs_ind_4:
+        MICRO(JMP_abs_ind_4)
             
             READ_FROM_ADDRESS
             SET_PCH(reg.d);
@@ -1540,27 +1567,27 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case JSR:
+        MICRO(JSR)
             
             FETCH_ADDR_LO
             CONTINUE
             
-        case JSR_2:
+        MICRO(JSR_2)
             
             IDLE_PULL
             CONTINUE
             
-        case JSR_3:
+        MICRO(JSR_3)
             
             PUSH_PCH
             CONTINUE
             
-        case JSR_4:
+        MICRO(JSR_4)
             
             PUSH_PCL
             CONTINUE
             
-        case JSR_5:
+        MICRO(JSR_5)
             
             FETCH_ADDR_HI
             reg.pc = LO_HI(reg.adl, reg.adh);
@@ -1575,24 +1602,24 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case LDA_imm:
+        MICRO(LDA_imm)
             
             READ_IMMEDIATE
             loadA(reg.d);
             POLL_INT
             DONE
 
-        case LDA_zpg_2:
-        case LDA_zpg_x_3:
+        MICRO(LDA_zpg_2)
+        MICRO(LDA_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             loadA(reg.d);
             POLL_INT
             DONE
 
-        case LDA_abs_x_3:
-        case LDA_abs_y_3:
-        case LDA_ind_y_4:
+        MICRO(LDA_abs_x_3)
+        MICRO(LDA_abs_y_3)
+        MICRO(LDA_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -1604,11 +1631,11 @@ Peddle::execute()
                 DONE
             }
             
-        case LDA_abs_3:
-        case LDA_abs_x_4:
-        case LDA_abs_y_4:
-        case LDA_ind_x_5:
-        case LDA_ind_y_5:
+        MICRO(LDA_abs_3)
+        MICRO(LDA_abs_x_4)
+        MICRO(LDA_abs_y_4)
+        MICRO(LDA_ind_x_5)
+        MICRO(LDA_ind_y_5)
             
             READ_FROM_ADDRESS
             loadA(reg.d);
@@ -1623,23 +1650,23 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case LDX_imm:
+        MICRO(LDX_imm)
             
             READ_IMMEDIATE
             loadX(reg.d);
             POLL_INT
             DONE
 
-        case LDX_zpg_2:
-        case LDX_zpg_y_3:
+        MICRO(LDX_zpg_2)
+        MICRO(LDX_zpg_y_3)
             
             READ_FROM_ZERO_PAGE
             loadX(reg.d);
             POLL_INT
             DONE
 
-        case LDX_abs_y_3:
-        case LDX_ind_y_4:
+        MICRO(LDX_abs_y_3)
+        MICRO(LDX_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -1651,10 +1678,10 @@ Peddle::execute()
                 DONE
             }
             
-        case LDX_abs_3:
-        case LDX_abs_y_4:
-        case LDX_ind_x_5:
-        case LDX_ind_y_5:
+        MICRO(LDX_abs_3)
+        MICRO(LDX_abs_y_4)
+        MICRO(LDX_ind_x_5)
+        MICRO(LDX_ind_y_5)
             
             READ_FROM_ADDRESS
             loadX(reg.d);
@@ -1669,23 +1696,23 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case LDY_imm:
+        MICRO(LDY_imm)
             
             READ_IMMEDIATE
             loadY(reg.d);
             POLL_INT
             DONE
             
-        case LDY_zpg_2:
-        case LDY_zpg_x_3:
+        MICRO(LDY_zpg_2)
+        MICRO(LDY_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             loadY(reg.d);
             POLL_INT
             DONE
 
-        case LDY_abs_x_3:
-        case LDY_ind_y_4:
+        MICRO(LDY_abs_x_3)
+        MICRO(LDY_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -1697,10 +1724,10 @@ Peddle::execute()
                 DONE
             }
 
-        case LDY_abs_3:
-        case LDY_abs_x_4:
-        case LDY_ind_x_5:
-        case LDY_ind_y_5:
+        MICRO(LDY_abs_3)
+        MICRO(LDY_abs_x_4)
+        MICRO(LDY_ind_x_5)
+        MICRO(LDY_ind_y_5)
             
             READ_FROM_ADDRESS
             loadY(reg.d);
@@ -1715,42 +1742,42 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              0 / / - - -
 
-        case LSR_acc:
+        MICRO(LSR_acc)
             
             IDLE_READ_IMPLIED
             setC(reg.a & 1); loadA(reg.a >> 1);
             POLL_INT
             DONE
 
-        case LSR_zpg_3:
-        case LSR_zpg_x_4:
+        MICRO(LSR_zpg_3)
+        MICRO(LSR_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             setC(reg.d & 1); reg.d = reg.d >> 1;
             CONTINUE
             
-        case LSR_zpg_4:
-        case LSR_zpg_x_5:
+        MICRO(LSR_zpg_4)
+        MICRO(LSR_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
             POLL_INT
             DONE
             
-        case LSR_abs_4:
-        case LSR_abs_x_5:
-        case LSR_abs_y_5:
-        case LSR_ind_x_6:
-        case LSR_ind_y_6:
+        MICRO(LSR_abs_4)
+        MICRO(LSR_abs_x_5)
+        MICRO(LSR_abs_y_5)
+        MICRO(LSR_ind_x_6)
+        MICRO(LSR_ind_y_6)
             
             WRITE_TO_ADDRESS
             setC(reg.d & 1); reg.d = reg.d >> 1;
             CONTINUE
             
-        case LSR_abs_5:
-        case LSR_abs_x_6:
-        case LSR_abs_y_6:
-        case LSR_ind_x_7:
-        case LSR_ind_y_7:
+        MICRO(LSR_abs_5)
+        MICRO(LSR_abs_x_6)
+        MICRO(LSR_abs_y_6)
+        MICRO(LSR_ind_x_7)
+        MICRO(LSR_ind_y_7)
             
             WRITE_TO_ADDRESS_AND_SET_FLAGS
             POLL_INT
@@ -1764,26 +1791,26 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case NOP:
+        MICRO(NOP)
             
             IDLE_READ_IMPLIED
             POLL_INT
             DONE
 
-        case NOP_imm:
+        MICRO(NOP_imm)
             
             IDLE_READ_IMMEDIATE
             POLL_INT
             DONE
 
-        case NOP_zpg_2:
-        case NOP_zpg_x_3:
+        MICRO(NOP_zpg_2)
+        MICRO(NOP_zpg_x_3)
             
             IDLE_READ_FROM_ZERO_PAGE
             POLL_INT
             DONE
             
-        case NOP_abs_x_3:
+        MICRO(NOP_abs_x_3)
             
             IDLE_READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -1794,8 +1821,8 @@ Peddle::execute()
                 DONE
             }
             
-        case NOP_abs_3:
-        case NOP_abs_x_4:
+        MICRO(NOP_abs_3)
+        MICRO(NOP_abs_x_4)
             
             IDLE_READ_FROM_ADDRESS
             POLL_INT
@@ -1809,24 +1836,24 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case ORA_imm:
+        MICRO(ORA_imm)
             
             READ_IMMEDIATE
             loadA(reg.a | reg.d);
             POLL_INT
             DONE
             
-        case ORA_zpg_2:
-        case ORA_zpg_x_3:
+        MICRO(ORA_zpg_2)
+        MICRO(ORA_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             loadA(reg.a | reg.d);
             POLL_INT
             DONE
 
-        case ORA_abs_x_3:
-        case ORA_abs_y_3:
-        case ORA_ind_y_4:
+        MICRO(ORA_abs_x_3)
+        MICRO(ORA_abs_y_3)
+        MICRO(ORA_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -1838,11 +1865,11 @@ Peddle::execute()
                 DONE
             }
             
-        case ORA_abs_3:
-        case ORA_abs_x_4:
-        case ORA_abs_y_4:
-        case ORA_ind_x_5:
-        case ORA_ind_y_5:
+        MICRO(ORA_abs_3)
+        MICRO(ORA_abs_x_4)
+        MICRO(ORA_abs_y_4)
+        MICRO(ORA_ind_x_5)
+        MICRO(ORA_ind_y_5)
             
             READ_FROM_ADDRESS
             loadA(reg.a | reg.d);
@@ -1857,7 +1884,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case PHA_2:
+        MICRO(PHA_2)
             
             PUSH_A
             POLL_INT
@@ -1871,7 +1898,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case PHP_2:
+        MICRO(PHP_2)
             
             PUSH_P
             POLL_INT
@@ -1885,12 +1912,12 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case PLA_2:
+        MICRO(PLA_2)
             
             reg.sp++;
             CONTINUE
             
-        case PLA_3:
+        MICRO(PLA_3)
             
             PULL_A
             POLL_INT
@@ -1904,13 +1931,13 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / / / /
             
-        case PLP_2:
+        MICRO(PLP_2)
 
             IDLE_PULL
             reg.sp++;
             CONTINUE
             
-        case PLP_3:
+        MICRO(PLP_3)
 
             POLL_INT // Interrupts are polled before P is pulled
             PULL_P
@@ -1929,38 +1956,38 @@ Peddle::execute()
 #define DO_ROL_ACC { u8 c = !!getC(); setC(reg.a & 0x80); loadA((u8)(reg.a << 1 | c)); }
 #define DO_ROL { u8 c = !!getC(); setC(reg.d & 0x80); reg.d = (u8)(reg.d << 1 | c); }
 
-        case ROL_acc:
+        MICRO(ROL_acc)
             
             IDLE_READ_IMPLIED
             DO_ROL_ACC
             POLL_INT
             DONE
             
-        case ROL_zpg_3:
-        case ROL_zpg_x_4:
+        MICRO(ROL_zpg_3)
+        MICRO(ROL_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_ROL
             CONTINUE
             
-        case ROL_zpg_4:
-        case ROL_zpg_x_5:
+        MICRO(ROL_zpg_4)
+        MICRO(ROL_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
             POLL_INT
             DONE
             
-        case ROL_abs_4:
-        case ROL_abs_x_5:
-        case ROL_ind_x_6:
+        MICRO(ROL_abs_4)
+        MICRO(ROL_abs_x_5)
+        MICRO(ROL_ind_x_6)
             
             WRITE_TO_ADDRESS
             DO_ROL
             CONTINUE
             
-        case ROL_abs_5:
-        case ROL_abs_x_6:
-        case ROL_ind_x_7:
+        MICRO(ROL_abs_5)
+        MICRO(ROL_abs_x_6)
+        MICRO(ROL_ind_x_7)
             
             WRITE_TO_ADDRESS_AND_SET_FLAGS
             POLL_INT
@@ -1979,38 +2006,38 @@ Peddle::execute()
 #define DO_ROR_ACC { u8 c = !!getC(); setC(reg.a & 0x1); loadA((u8)(reg.a >> 1 | c << 7)); }
 #define DO_ROR { u8 c = !!getC(); setC(reg.d & 0x1); reg.d = (u8)(reg.d >> 1 | c << 7); }
             
-        case ROR_acc:
+        MICRO(ROR_acc)
             
             IDLE_READ_IMPLIED
             DO_ROR_ACC
             POLL_INT
             DONE
             
-        case ROR_zpg_3:
-        case ROR_zpg_x_4:
+        MICRO(ROR_zpg_3)
+        MICRO(ROR_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_ROR
             CONTINUE
             
-        case ROR_zpg_4:
-        case ROR_zpg_x_5:
+        MICRO(ROR_zpg_4)
+        MICRO(ROR_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
             POLL_INT
             DONE
             
-        case ROR_abs_4:
-        case ROR_abs_x_5:
-        case ROR_ind_x_6:
+        MICRO(ROR_abs_4)
+        MICRO(ROR_abs_x_5)
+        MICRO(ROR_ind_x_6)
             
             WRITE_TO_ADDRESS
             DO_ROR
             CONTINUE
             
-        case ROR_abs_5:
-        case ROR_abs_x_6:
-        case ROR_ind_x_7:
+        MICRO(ROR_abs_5)
+        MICRO(ROR_abs_x_6)
+        MICRO(ROR_ind_x_7)
             
             WRITE_TO_ADDRESS_AND_SET_FLAGS
             POLL_INT
@@ -2024,25 +2051,25 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / / / /
             
-        case RTI_2:
+        MICRO(RTI_2)
             
             IDLE_PULL
             reg.sp++;
             CONTINUE
             
-        case RTI_3:
+        MICRO(RTI_3)
             
             PULL_P
             reg.sp++;
             CONTINUE
             
-        case RTI_4:
+        MICRO(RTI_4)
             
             PULL_PCL
             reg.sp++;
             CONTINUE
             
-        case RTI_5:
+        MICRO(RTI_5)
             
             PULL_PCH
             POLL_INT
@@ -2056,24 +2083,24 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case RTS_2:
+        MICRO(RTS_2)
             
             IDLE_PULL
             reg.sp++;
             CONTINUE
             
-        case RTS_3:
+        MICRO(RTS_3)
             
             PULL_PCL
             reg.sp++;
             CONTINUE
             
-        case RTS_4:
+        MICRO(RTS_4)
             
             PULL_PCH
             CONTINUE
             
-        case RTS_5:
+        MICRO(RTS_5)
             
             IDLE_READ_IMMEDIATE
             POLL_INT
@@ -2087,24 +2114,24 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - /
 
-        case SBC_imm:
+        MICRO(SBC_imm)
             
             READ_IMMEDIATE
             sbc(reg.d);
             POLL_INT
             DONE
             
-        case SBC_zpg_2:
-        case SBC_zpg_x_3:
+        MICRO(SBC_zpg_2)
+        MICRO(SBC_zpg_x_3)
             
             READ_FROM_ZERO_PAGE
             sbc(reg.d);
             POLL_INT
             DONE
             
-        case SBC_abs_x_3:
-        case SBC_abs_y_3:
-        case SBC_ind_y_4:
+        MICRO(SBC_abs_x_3)
+        MICRO(SBC_abs_y_3)
+        MICRO(SBC_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -2116,11 +2143,11 @@ Peddle::execute()
                 DONE
             }
             
-        case SBC_abs_3:
-        case SBC_abs_x_4:
-        case SBC_abs_y_4:
-        case SBC_ind_x_5:
-        case SBC_ind_y_5:
+        MICRO(SBC_abs_3)
+        MICRO(SBC_abs_x_4)
+        MICRO(SBC_abs_y_4)
+        MICRO(SBC_ind_x_5)
+        MICRO(SBC_ind_y_5)
             
             READ_FROM_ADDRESS
             sbc(reg.d);
@@ -2135,7 +2162,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - 1 - - -
 
-        case SEC:
+        MICRO(SEC)
             
             IDLE_READ_IMPLIED
             setC(1);
@@ -2150,7 +2177,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - 1 -
 
-        case SED:
+        MICRO(SED)
             
             IDLE_READ_IMPLIED
             setD(1);
@@ -2165,13 +2192,13 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - 1 - -
 
-        case SEI:
+        MICRO(SEI)
             
             POLL_IRQ
             setI(1);
             [[fallthrough]];
             
-        case SEI_cont:
+        MICRO(SEI_cont)
             
             next = SEI_cont;
             IDLE_READ_IMPLIED
@@ -2186,25 +2213,25 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case STA_zpg_2:
-        case STA_zpg_x_3:
+        MICRO(STA_zpg_2)
+        MICRO(STA_zpg_x_3)
             
             reg.d = reg.a;
             WRITE_TO_ZERO_PAGE
             POLL_INT
             DONE
             
-        case STA_abs_3:
-        case STA_abs_x_4:
+        MICRO(STA_abs_3)
+        MICRO(STA_abs_x_4)
             
             reg.d = reg.a;
             WRITE_TO_ADDRESS
             POLL_INT
             DONE
             
-        case STA_abs_y_4:
-        case STA_ind_x_5:
-        case STA_ind_y_5:
+        MICRO(STA_abs_y_4)
+        MICRO(STA_ind_x_5)
+        MICRO(STA_ind_y_5)
             
             reg.d = reg.a;
             WRITE_TO_ADDRESS
@@ -2219,15 +2246,15 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case STX_zpg_2:
-        case STX_zpg_y_3:
+        MICRO(STX_zpg_2)
+        MICRO(STX_zpg_y_3)
             
             reg.d = reg.x;
             WRITE_TO_ZERO_PAGE
             POLL_INT
             DONE
             
-        case STX_abs_3:
+        MICRO(STX_abs_3)
             
             reg.d = reg.x;
             WRITE_TO_ADDRESS
@@ -2242,15 +2269,15 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case STY_zpg_2:
-        case STY_zpg_x_3:
+        MICRO(STY_zpg_2)
+        MICRO(STY_zpg_x_3)
             
             reg.d = reg.y;
             WRITE_TO_ZERO_PAGE
             POLL_INT
             DONE
             
-        case STY_abs_3:
+        MICRO(STY_abs_3)
             
             reg.d = reg.y;
             WRITE_TO_ADDRESS
@@ -2265,7 +2292,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case TAX:
+        MICRO(TAX)
             
             IDLE_READ_IMPLIED
             loadX(reg.a);
@@ -2280,7 +2307,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case TAY:
+        MICRO(TAY)
             
             IDLE_READ_IMPLIED
             loadY(reg.a);
@@ -2295,7 +2322,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case TSX:
+        MICRO(TSX)
             
             IDLE_READ_IMPLIED
             loadX(reg.sp);
@@ -2310,7 +2337,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case TXA:
+        MICRO(TXA)
             
             IDLE_READ_IMPLIED
             loadA(reg.x);
@@ -2325,7 +2352,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case TXS:
+        MICRO(TXS)
             
             IDLE_READ_IMPLIED
             reg.sp = reg.x;
@@ -2340,7 +2367,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case TYA:
+        MICRO(TYA)
             
             IDLE_READ_IMPLIED
             loadA(reg.y);
@@ -2360,7 +2387,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - -
 
-        case ALR_imm:
+        MICRO(ALR_imm)
             
             READ_IMMEDIATE
             reg.a = reg.a & reg.d;
@@ -2377,7 +2404,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - -
 
-        case ANC_imm:
+        MICRO(ANC_imm)
             
             READ_IMMEDIATE
             loadA(reg.a & reg.d);
@@ -2393,7 +2420,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - /
 
-        case ARR_imm:
+        MICRO(ARR_imm)
         {
             READ_IMMEDIATE
             
@@ -2434,7 +2461,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - -
 
-        case AXS_imm:
+        MICRO(AXS_imm)
         {
             READ_IMMEDIATE
             
@@ -2455,36 +2482,36 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - -
             
-        case DCP_zpg_3:
-        case DCP_zpg_x_4:
+        MICRO(DCP_zpg_3)
+        MICRO(DCP_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             reg.d--;
             CONTINUE
             
-        case DCP_zpg_4:
-        case DCP_zpg_x_5:
+        MICRO(DCP_zpg_4)
+        MICRO(DCP_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
             cmp(reg.a, reg.d);
             POLL_INT
             DONE
             
-        case DCP_abs_4:
-        case DCP_abs_x_5:
-        case DCP_abs_y_5:
-        case DCP_ind_x_6:
-        case DCP_ind_y_6:
+        MICRO(DCP_abs_4)
+        MICRO(DCP_abs_x_5)
+        MICRO(DCP_abs_y_5)
+        MICRO(DCP_ind_x_6)
+        MICRO(DCP_ind_y_6)
             
             WRITE_TO_ADDRESS
             reg.d--;
             CONTINUE
             
-        case DCP_abs_5:
-        case DCP_abs_x_6:
-        case DCP_abs_y_6:
-        case DCP_ind_x_7:
-        case DCP_ind_y_7:
+        MICRO(DCP_abs_5)
+        MICRO(DCP_abs_x_6)
+        MICRO(DCP_abs_y_6)
+        MICRO(DCP_ind_x_7)
+        MICRO(DCP_ind_y_7)
             
             WRITE_TO_ADDRESS_AND_SET_FLAGS
             cmp(reg.a, reg.d);
@@ -2499,36 +2526,36 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - /
             
-        case ISC_zpg_3:
-        case ISC_zpg_x_4:
+        MICRO(ISC_zpg_3)
+        MICRO(ISC_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             reg.d++;
             CONTINUE
             
-        case ISC_zpg_4:
-        case ISC_zpg_x_5:
+        MICRO(ISC_zpg_4)
+        MICRO(ISC_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE_AND_SET_FLAGS
             sbc(reg.d);
             POLL_INT
             DONE
 
-        case ISC_abs_4:
-        case ISC_abs_x_5:
-        case ISC_abs_y_5:
-        case ISC_ind_x_6:
-        case ISC_ind_y_6:
+        MICRO(ISC_abs_4)
+        MICRO(ISC_abs_x_5)
+        MICRO(ISC_abs_y_5)
+        MICRO(ISC_ind_x_6)
+        MICRO(ISC_ind_y_6)
             
             WRITE_TO_ADDRESS
             reg.d++;
             CONTINUE
             
-        case ISC_abs_5:
-        case ISC_abs_x_6:
-        case ISC_abs_y_6:
-        case ISC_ind_x_7:
-        case ISC_ind_y_7:
+        MICRO(ISC_abs_5)
+        MICRO(ISC_abs_x_6)
+        MICRO(ISC_abs_y_6)
+        MICRO(ISC_ind_x_7)
+        MICRO(ISC_ind_y_7)
             
             WRITE_TO_ADDRESS_AND_SET_FLAGS
             sbc(reg.d);
@@ -2543,7 +2570,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
             
-        case LAS_abs_y_3:
+        MICRO(LAS_abs_y_3)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -2558,7 +2585,7 @@ Peddle::execute()
                 DONE
             }
             
-        case LAS_abs_y_4:
+        MICRO(LAS_abs_y_4)
             
             READ_FROM_ADDRESS
             reg.d &= reg.sp;
@@ -2576,8 +2603,8 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
             
-        case LAX_zpg_2:
-        case LAX_zpg_y_3:
+        MICRO(LAX_zpg_2)
+        MICRO(LAX_zpg_y_3)
             
             READ_FROM_ZERO_PAGE
             loadA(reg.d);
@@ -2585,8 +2612,8 @@ Peddle::execute()
             POLL_INT
             DONE
             
-        case LAX_abs_y_3:
-        case LAX_ind_y_4:
+        MICRO(LAX_abs_y_3)
+        MICRO(LAX_ind_y_4)
             
             READ_FROM_ADDRESS
             if (PAGE_BOUNDARY_CROSSED) {
@@ -2599,10 +2626,10 @@ Peddle::execute()
                 DONE
             }
             
-        case LAX_abs_3:
-        case LAX_abs_y_4:
-        case LAX_ind_x_5:
-        case LAX_ind_y_5:
+        MICRO(LAX_abs_3)
+        MICRO(LAX_abs_y_4)
+        MICRO(LAX_ind_x_5)
+        MICRO(LAX_ind_y_5)
             
             READ_FROM_ADDRESS;
             loadA(reg.d);
@@ -2618,36 +2645,36 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - -
             
-        case RLA_zpg_3:
-        case RLA_zpg_x_4:
+        MICRO(RLA_zpg_3)
+        MICRO(RLA_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_ROL
             CONTINUE
             
-        case RLA_zpg_4:
-        case RLA_zpg_x_5:
+        MICRO(RLA_zpg_4)
+        MICRO(RLA_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE
             loadA(reg.a & reg.d);
             POLL_INT
             DONE
             
-        case RLA_abs_4:
-        case RLA_abs_x_5:
-        case RLA_abs_y_5:
-        case RLA_ind_x_6:
-        case RLA_ind_y_6:
+        MICRO(RLA_abs_4)
+        MICRO(RLA_abs_x_5)
+        MICRO(RLA_abs_y_5)
+        MICRO(RLA_ind_x_6)
+        MICRO(RLA_ind_y_6)
             
             WRITE_TO_ADDRESS
             DO_ROL
             CONTINUE
             
-        case RLA_abs_5:
-        case RLA_abs_x_6:
-        case RLA_abs_y_6:
-        case RLA_ind_x_7:
-        case RLA_ind_y_7:
+        MICRO(RLA_abs_5)
+        MICRO(RLA_abs_x_6)
+        MICRO(RLA_abs_y_6)
+        MICRO(RLA_ind_x_7)
+        MICRO(RLA_ind_y_7)
             
             WRITE_TO_ADDRESS
             loadA(reg.a & reg.d);
@@ -2661,36 +2688,36 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / / - - /
             
-        case RRA_zpg_3:
-        case RRA_zpg_x_4:
+        MICRO(RRA_zpg_3)
+        MICRO(RRA_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_ROR
             CONTINUE
             
-        case RRA_zpg_4:
-        case RRA_zpg_x_5:
+        MICRO(RRA_zpg_4)
+        MICRO(RRA_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE
             adc(reg.d);
             POLL_INT
             DONE
 
-        case RRA_abs_4:
-        case RRA_abs_x_5:
-        case RRA_abs_y_5:
-        case RRA_ind_x_6:
-        case RRA_ind_y_6:
+        MICRO(RRA_abs_4)
+        MICRO(RRA_abs_x_5)
+        MICRO(RRA_abs_y_5)
+        MICRO(RRA_ind_x_6)
+        MICRO(RRA_ind_y_6)
             
             WRITE_TO_ADDRESS
             DO_ROR
             CONTINUE
             
-        case RRA_abs_5:
-        case RRA_abs_x_6:
-        case RRA_abs_y_6:
-        case RRA_ind_x_7:
-        case RRA_ind_y_7:
+        MICRO(RRA_abs_5)
+        MICRO(RRA_abs_x_6)
+        MICRO(RRA_abs_y_6)
+        MICRO(RRA_ind_x_7)
+        MICRO(RRA_ind_y_7)
             
             WRITE_TO_ADDRESS
             adc(reg.d);
@@ -2705,16 +2732,16 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case SAX_zpg_2:
-        case SAX_zpg_y_3:
+        MICRO(SAX_zpg_2)
+        MICRO(SAX_zpg_y_3)
             
             reg.d = reg.a & reg.x;
             WRITE_TO_ZERO_PAGE
             POLL_INT
             DONE
 
-        case SAX_abs_3:
-        case SAX_ind_x_5:
+        MICRO(SAX_abs_3)
+        MICRO(SAX_ind_x_5)
             
             reg.d = reg.a & reg.x;
             WRITE_TO_ADDRESS
@@ -2729,7 +2756,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case SHA_abs_y_3:
+        MICRO(SHA_abs_y_3)
             
             IDLE_READ_FROM_ADDRESS
             
@@ -2752,13 +2779,13 @@ Peddle::execute()
             
             CONTINUE
             
-        case SHA_abs_y_4:
+        MICRO(SHA_abs_y_4)
             
             WRITE_TO_ADDRESS
             POLL_INT
             DONE
             
-        case SHA_ind_y_4:
+        MICRO(SHA_ind_y_4)
             
             IDLE_READ_FROM_ADDRESS
             
@@ -2781,7 +2808,7 @@ Peddle::execute()
 
             CONTINUE
             
-        case SHA_ind_y_5:
+        MICRO(SHA_ind_y_5)
             
             WRITE_TO_ADDRESS
             POLL_INT
@@ -2795,7 +2822,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
 
-        case SHX_abs_y_3:
+        MICRO(SHX_abs_y_3)
             
             IDLE_READ_FROM_ADDRESS
             
@@ -2818,7 +2845,7 @@ Peddle::execute()
             
             CONTINUE
 
-        case SHX_abs_y_4:
+        MICRO(SHX_abs_y_4)
             
             WRITE_TO_ADDRESS
             POLL_INT
@@ -2832,7 +2859,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case SHY_abs_x_3:
+        MICRO(SHY_abs_x_3)
             
             IDLE_READ_FROM_ADDRESS
             
@@ -2855,7 +2882,7 @@ Peddle::execute()
 
             CONTINUE
             
-        case SHY_abs_x_4:
+        MICRO(SHY_abs_x_4)
             
             WRITE_TO_ADDRESS
             POLL_INT
@@ -2871,36 +2898,36 @@ Peddle::execute()
 
 #define DO_SLO setC(reg.d & 128); reg.d <<= 1;
 
-        case SLO_zpg_3:
-        case SLO_zpg_x_4:
+        MICRO(SLO_zpg_3)
+        MICRO(SLO_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_SLO
             CONTINUE
             
-        case SLO_zpg_4:
-        case SLO_zpg_x_5:
+        MICRO(SLO_zpg_4)
+        MICRO(SLO_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE
             loadA(reg.a | reg.d);
             POLL_INT
             DONE
             
-        case SLO_abs_4:
-        case SLO_abs_x_5:
-        case SLO_abs_y_5:
-        case SLO_ind_x_6:
-        case SLO_ind_y_6:
+        MICRO(SLO_abs_4)
+        MICRO(SLO_abs_x_5)
+        MICRO(SLO_abs_y_5)
+        MICRO(SLO_ind_x_6)
+        MICRO(SLO_ind_y_6)
             
             WRITE_TO_ADDRESS
             DO_SLO
             CONTINUE
             
-        case SLO_abs_5:
-        case SLO_abs_x_6:
-        case SLO_abs_y_6:
-        case SLO_ind_x_7:
-        case SLO_ind_y_7:
+        MICRO(SLO_abs_5)
+        MICRO(SLO_abs_x_6)
+        MICRO(SLO_abs_y_6)
+        MICRO(SLO_ind_x_7)
+        MICRO(SLO_ind_y_7)
             
             WRITE_TO_ADDRESS
             loadA(reg.a | reg.d);
@@ -2917,36 +2944,36 @@ Peddle::execute()
 
 #define DO_SRE setC(reg.d & 1); reg.d >>= 1;
 
-        case SRE_zpg_3:
-        case SRE_zpg_x_4:
+        MICRO(SRE_zpg_3)
+        MICRO(SRE_zpg_x_4)
             
             WRITE_TO_ZERO_PAGE
             DO_SRE
             CONTINUE
             
-        case SRE_zpg_4:
-        case SRE_zpg_x_5:
+        MICRO(SRE_zpg_4)
+        MICRO(SRE_zpg_x_5)
             
             WRITE_TO_ZERO_PAGE
             loadA(reg.a ^ reg.d);
             POLL_INT
             DONE
             
-        case SRE_abs_4:
-        case SRE_abs_x_5:
-        case SRE_abs_y_5:
-        case SRE_ind_x_6:
-        case SRE_ind_y_6:
+        MICRO(SRE_abs_4)
+        MICRO(SRE_abs_x_5)
+        MICRO(SRE_abs_y_5)
+        MICRO(SRE_ind_x_6)
+        MICRO(SRE_ind_y_6)
             
             WRITE_TO_ADDRESS
             DO_SRE
             CONTINUE
             
-        case SRE_abs_5:
-        case SRE_abs_x_6:
-        case SRE_abs_y_6:
-        case SRE_ind_x_7:
-        case SRE_ind_y_7:
+        MICRO(SRE_abs_5)
+        MICRO(SRE_abs_x_6)
+        MICRO(SRE_abs_y_6)
+        MICRO(SRE_ind_x_7)
+        MICRO(SRE_ind_y_7)
             
             WRITE_TO_ADDRESS
             loadA(reg.a ^ reg.d);
@@ -2961,7 +2988,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              - - - - - -
             
-        case TAS_abs_y_3:
+        MICRO(TAS_abs_y_3)
             
             IDLE_READ_FROM_ADDRESS
             
@@ -2986,7 +3013,7 @@ Peddle::execute()
 
             CONTINUE
             
-        case TAS_abs_y_4:
+        MICRO(TAS_abs_y_4)
             
             WRITE_TO_ADDRESS
             POLL_INT
@@ -2999,7 +3026,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case ANE_imm:
+        MICRO(ANE_imm)
             
             READ_IMMEDIATE
             loadA(reg.x & reg.d & (reg.a | 0xEE));
@@ -3014,7 +3041,7 @@ Peddle::execute()
             // Flags:       N Z C I D V
             //              / / - - - -
 
-        case LXA_imm:
+        MICRO(LXA_imm)
             
             READ_IMMEDIATE
             reg.x = reg.d & (reg.a | 0xEE);
@@ -3028,6 +3055,9 @@ Peddle::execute()
     }
 }
 
+template void Peddle::execute<MOS_6510, false>();
+template void Peddle::execute<MOS_6510, true>();
+
 void
 Peddle::execute(int count)
 {
@@ -132,7 +132,11 @@ IEC::updateIecLines()
 void 
 IEC::setNeedsUpdate()
 {
-    c64.scheduleImm<SLOT_IEC>(IEC_UPDATE);
+    if (c64.isCatchingUp()) {
+        pendingUpdate = true;
+    } else {
+        c64.scheduleImm<SLOT_IEC>(IEC_UPDATE);
+    }
 }
 
 void
@@ -159,6 +163,7 @@ IEC::update()
     updateIecLines();
 
     c64.cancel<SLOT_IEC>();
+    pendingUpdate = false;
 }
 
 void
@@ -172,6 +177,9 @@ IEC::execute()
 void
 IEC::updateTransferStatus()
 {
+    // Postpone the update if a drive is catching up with the C64
+    if (c64.isCatchingUp()) { pendingStatus = true; return; }
+
     bool rotating = drive8.isRotating() || drive9.isRotating();
     bool newValue = rotating && idle < 32;
     
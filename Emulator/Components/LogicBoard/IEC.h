@@ -42,6 +42,15 @@ public:
 
     // Bus idle time measured in frames
     i64 idle = 0;
+
+    /* Indicates that a drive has requested a bus update while catching up
+     * with the C64 (see C64::syncDrives()). In this mode, the update is not
+     * scheduled in the event table, because the drive lags behind the C64.
+     */
+    bool pendingUpdate = false;
+
+    // Indicates that a drive has changed its rotation state while catching up
+    bool pendingStatus = false;
     
 private:
 
@@ -98,6 +98,7 @@ C64Memory::C64Memory(C64 &ref) : SubComponent(ref)
     for (isize i = 0x1; i <= 0xF; i++) {
         peekSrc[i] = pokeTarget[i] = M_RAM;
     }
+    updatePagePointers();
 }
 
 void
@@ -378,6 +379,42 @@ C64Memory::updatePeekPokeLookupTables()
     
     // Call the Cartridge's delegation method
     expansionport.updatePeekPokeLookupTables();
+
+    // Update the page pointers (the cartridge might have altered the tables)
+    updatePagePointers();
+}
+
+void
+C64Memory::updatePagePointers()
+{
+    for (isize page = 0; page < 256; page++) {
+
+        auto offset = page << 8;
+
+        switch (peekSrc[page >> 4]) {
+
+            case M_RAM:     peekPtr[page] = ram + offset; break;
+            case M_BASIC:
+            case M_CHAR:
+            case M_KERNAL:  peekPtr[page] = rom + offset; break;
+            case M_PP:      peekPtr[page] = page ? ram + offset : nullptr; break;
+
+            default:
+                peekPtr[page] = nullptr;
+        }
+
+        switch (pokeTarget[page >> 4]) {
+
+            case M_RAM:
+            case M_BASIC:
+            case M_CHAR:
+            case M_KERNAL:  pokePtr[page] = ram + offset; break;
+            case M_PP:      pokePtr[page] = page ? ram + offset : nullptr; break;
+
+            default:
+                pokePtr[page] = nullptr;
+        }
+    }
 }
 
 u8
@@ -700,7 +737,9 @@ C64Memory::pokeIO(u16 addr, u8 value)
         case 0xA: // Color RAM
         case 0xB: // Color RAM
             
-            colorRam[addr - 0xD800] = (value & 0x0F) | (rand() & 0xF0);
+            // The upper nibble is not connected. To keep the emulator state
+            // deterministic, it is left untouched instead of randomized.
+            colorRam[addr - 0xD800] = (value & 0x0F) | (colorRam[addr - 0xD800] & 0xF0);
             return;
             
         case 0xC: // CIA 1
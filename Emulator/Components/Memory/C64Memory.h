@@ -59,6 +59,15 @@ public:
     
     // Poke target lookup table
     MemoryType pokeTarget[16];
+
+    /* Page pointer tables (one entry for each 256 byte page). If a page is
+     * backed by plain RAM or ROM, the entry points to the first memory cell
+     * of this page and the CPU accesses the cell directly. All other pages
+     * (I/O, cartridge, processor port, unmapped) have a nullptr entry and are
+     * resolved via the peekSrc and pokeTarget lookup tables.
+     */
+    u8 *peekPtr[256];
+    u8 *pokePtr[256];
     
     // Indicates if watchpoints should be checked
     bool checkWatchpoints = false;
@@ -90,6 +99,7 @@ private:
 private:
 
     void _reset(bool hard) override;
+    void _didLoad() override { updatePagePointers(); }
     
     template <class T>
     void applyToRoms(T& worker)
@@ -159,6 +169,9 @@ public:
      */
     void updatePeekPokeLookupTables();
 
+    // Derives the page pointer tables from the peek and poke lookup tables
+    void updatePagePointers();
+
     // Returns the current peek source of the specified memory address
     MemoryType getPeekSource(u16 addr) { return peekSrc[addr >> 12]; }
     
@@ -168,7 +181,10 @@ public:
     // Reads a value from memory
     u8 peek(u16 addr, MemoryType source);
     u8 peek(u16 addr, bool gameLine, bool exromLine);
-    u8 peek(u16 addr) { return peek(addr, peekSrc[addr >> 12]); }
+    u8 peek(u16 addr) {
+        auto page = peekPtr[addr >> 8];
+        return page ? page[addr & 0xFF] : peek(addr, peekSrc[addr >> 12]);
+    }
     u8 peekZP(u8 addr);
     u8 peekStack(u8 sp);
     u8 peekIO(u16 addr);
@@ -188,7 +204,13 @@ public:
     // Writing a value into memory
     void poke(u16 addr, u8 value, MemoryType target);
     void poke(u16 addr, u8 value, bool gameLine, bool exromLine);
-    void poke(u16 addr, u8 value) { poke(addr, value, pokeTarget[addr >> 12]); }
+    void poke(u16 addr, u8 value) {
+        if (auto page = pokePtr[addr >> 8]) {
+            page[addr & 0xFF] = value;
+        } else {
+            poke(addr, value, pokeTarget[addr >> 12]);
+        }
+    }
     void pokeZP(u8 addr, u8 value);
     void pokeStack(u8 sp, u8 value);
     void pokeIO(u16 addr, u8 value);
@@ -40,6 +40,11 @@ Muxer::Muxer(C64 &ref) : SubComponent(ref)
     }
 }
 
+Muxer::~Muxer()
+{
+    haltWorkers();
+}
+
 void
 Muxer::_reset(bool hard)
 {
@@ -76,6 +81,7 @@ Muxer::getDefaultConfig()
     defaults.filter = true;
     defaults.engine = SIDENGINE_RESID;
     defaults.sampling = SAMPLING_INTERPOLATE;
+    defaults.parallel = true;
     defaults.volL = 50;
     defaults.volR = 50;
     
@@ -99,6 +105,7 @@ Muxer::resetConfig()
         OPT_SID_FILTER,
         OPT_SID_ENGINE,
         OPT_SID_SAMPLING,
+        OPT_SID_PARALLEL,
         OPT_AUDVOLL,
         OPT_AUDVOLR
     };
@@ -141,6 +148,9 @@ Muxer::getConfigItem(Option option) const
             
         case OPT_SID_SAMPLING:
             return config.sampling;
+
+        case OPT_SID_PARALLEL:
+            return config.parallel;
             
         case OPT_AUDVOLL:
             return config.volL;
@@ -247,6 +257,15 @@ Muxer::setConfigItem(Option option, i64 value)
             }
             return;
         }
+        case OPT_SID_PARALLEL:
+        {
+            {   SUSPENDED
+
+                config.parallel = bool(value);
+                if (!config.parallel) haltWorkers();
+            }
+            return;
+        }
         case OPT_AUDVOLL:
             
             config.volL = std::clamp(value, 0LL, 100LL);
@@ -296,6 +315,7 @@ Muxer::setConfigItem(Option option, long id, i64 value)
                 
                 REPLACE_BIT(config.enabled, id, value);
                 clearSampleBuffer(id);
+                if (!value) haltWorker(id);
                 
                 for (int i = 0; i < 4; i++) {
                     resid[i].reset(true);
@@ -491,6 +511,8 @@ Muxer::_dump(Category category, std::ostream& os) const
         os << SIDEngineEnum::key(config.engine) << std::endl;
         os << tab("Sampling");
         os << SamplingMethodEnum::key(config.sampling) << std::endl;
+        os << tab("Parallel synthesis");
+        os << bol(config.parallel) << std::endl;
         os << tab("Volume 1");
         os << config.vol[0] << std::endl;
         os << tab("Volume 2");
@@ -527,6 +549,8 @@ SIDStats
 Muxer::getStats()
 {
     stats.fillLevel = stream.fillLevel();
+    stats.underruns = stream.underruns;
+    stats.contentions = stream.contentions;
     return stats;
 }
 
@@ -534,6 +558,8 @@ void
 Muxer::clearStats()
 {
     memset(&stats, 0, sizeof(stats));
+    stream.underruns = 0;
+    stream.contentions = 0;
 }
 
 SIDInfo
@@ -766,64 +792,151 @@ Muxer::executeUntil(Cycle targetCycle)
 isize
 Muxer::executeCycles(isize numCycles)
 {
-    isize numSamples;
-    
     // Run reSID for at least one cycle to make pipelined writes work
     if (numCycles == 0) {
         
         numCycles = 1;
         debug(SID_EXEC, "Running SIDs for an extra cycle\n");
     }
-    
-    switch (config.engine) {
-            
-        case SIDENGINE_FASTSID:
 
-            // Run the primary SID (which is always enabled)
-            numSamples = fastsid[0].executeCycles(numCycles, sidStream[0]);
-            
-            // Run all other SIDS (if any)
-            if (config.enabled > 1) {
-                for (isize i = 1; i < 4; i++) {
-                    if (isEnabled(i)) {
-                        isize numSamples2 = fastsid[i].executeCycles(numCycles, sidStream[i]);
-                        numSamples = std::min(numSamples, numSamples2);
-                    }
-                }
-            }
-            break;
+    // Decide whether the additional SIDs are emulated on the worker threads
+    bool parallel =
+    config.parallel && config.enabled > 1 && numCycles >= minParallelCycles &&
+    !c64.isPooled();
 
-        case SIDENGINE_RESID:
+    if (parallel) {
+        for (isize i = 1; i < 4; i++) if (isEnabled(i)) dispatch(i, numCycles);
+    }
 
-            // Run the primary SID (which is always enabled)
-            numSamples = resid[0].executeCycles(numCycles, sidStream[0]);
-            
-            // Run all other SIDS (if any)
-            if (config.enabled > 1) {
-                for (isize i = 1; i < 4; i++) {
-                    if (isEnabled(i)) {
-                        isize numSamples2 = resid[i].executeCycles(numCycles, sidStream[i]);
-                        numSamples = std::min(numSamples, numSamples2);
-                    }
-                }
-            }
-            break;
+    // Run the primary SID (which is always enabled)
+    isize numSamples = synthesize(0, numCycles);
 
-        default:
-            fatalError;
+    // Run all other SIDS (if any)
+    if (config.enabled > 1) {
+        for (isize i = 1; i < 4; i++) {
+            if (isEnabled(i)) {
+                isize numSamples2 = parallel ? join(i) : synthesize(i, numCycles);
+                numSamples = std::min(numSamples, numSamples2);
+            }
+        }
     }
     
+    // Discard the samples of run-ahead frames
+    if (c64.isRunningAhead()) {
+
+        for (isize i = 0; i < 4; i++) sidStream[i].clear();
+        return numCycles;
+    }
+
     // Produce the final stereo stream
     (config.enabled > 1) ? mixMultiSID(numSamples) : mixSingleSID(numSamples);
     
     return numCycles;
 }
 
+isize
+Muxer::synthesize(isize nr, isize numCycles)
+{
+    switch (config.engine) {
+
+        case SIDENGINE_FASTSID: return fastsid[nr].executeCycles(numCycles, sidStream[nr]);
+        case SIDENGINE_RESID:   return resid[nr].executeCycles(numCycles, sidStream[nr]);
+
+        default:
+            fatalError;
+    }
+}
+
+void
+Muxer::dispatch(isize nr, isize numCycles)
+{
+    assert(owner[nr].load(std::memory_order_relaxed) == OWNER_MUXER);
+
+    launchWorker(nr);
+
+    jobCycles[nr] = numCycles;
+    owner[nr].store(OWNER_WORKER, std::memory_order_release);
+    owner[nr].notify_one();
+}
+
+isize
+Muxer::join(isize nr)
+{
+    // Wait until the worker returns the SID
+    owner[nr].wait(OWNER_WORKER, std::memory_order_acquire);
+    return jobSamples[nr];
+}
+
+void
+Muxer::launchWorker(isize nr)
+{
+    if (!worker[nr].joinable()) {
+
+        debug(RUN_DEBUG, "Launching the worker thread for SID %ld\n", nr);
+        worker[nr] = std::thread(&Muxer::runWorker, this, nr);
+    }
+}
+
+void
+Muxer::haltWorker(isize nr)
+{
+    if (worker[nr].joinable()) {
+
+        debug(RUN_DEBUG, "Halting the worker thread for SID %ld\n", nr);
+
+        owner[nr].store(OWNER_NONE, std::memory_order_release);
+        owner[nr].notify_one();
+        worker[nr].join();
+        owner[nr] = OWNER_MUXER;
+    }
+}
+
+void
+Muxer::haltWorkers()
+{
+    for (isize i = 1; i < 4; i++) haltWorker(i);
+}
+
+void
+Muxer::runWorker(isize nr)
+{
+    while (true) {
+
+        // Wait until the emulator thread hands over the SID
+        owner[nr].wait(OWNER_MUXER, std::memory_order_acquire);
+        if (owner[nr].load(std::memory_order_acquire) == OWNER_NONE) break;
+
+        jobSamples[nr] = synthesize(nr, jobCycles[nr]);
+
+        // Return the SID to the emulator thread
+        owner[nr].store(OWNER_MUXER, std::memory_order_release);
+        owner[nr].notify_one();
+    }
+}
+
+/* Converts the next n samples of a SID stream into floating point values. The
+ * samples are read in contiguous blocks to enable the compiler to vectorize
+ * the conversion. If the stream runs dry, the remaining values are zero.
+ */
+static void
+convertSamples(SampleStream &stream, float *dst, isize n, float volume)
+{
+    auto available = std::min(n, stream.count());
+
+    for (isize m; available > 0; available -= m, n -= m, dst += m) {
+
+        m = std::min(available, stream.contiguousCount());
+
+        const short *src = stream.currentAddr();
+        for (isize i = 0; i < m; i++) dst[i] = (float)src[i] * volume;
+        stream.skip(m);
+    }
+    for (isize i = 0; i < n; i++) dst[i] = 0.0f;
+}
+
 void
 Muxer::mixSingleSID(isize numSamples)
 {    
-    stream.lock();
-    
     // Check for buffer overflow
     if (stream.free() < numSamples) {
         handleBufferOverflow();
@@ -832,34 +945,45 @@ Muxer::mixSingleSID(isize numSamples)
     debug(SID_EXEC, "vol0: %f pan0: %f volL: %f volR: %f\n",
           vol[0], pan[0], volL.current, volR.current);
 
-    // Convert sound samples to floating point values and write into ringbuffer
-    for (isize i = 0; i < numSamples; i++) {
-        
-        // Read SID sample from ring buffer
-        float ch0 = (float)sidStream[0].read() * vol[0];
-        
-        // Compute left and right channel output
-        float l = ch0 * (1 - pan[0]);
-        float r = ch0 * pan[0];
+    float ch0[mixBlockSize];
+    float pl = 1 - pan[0], pr = pan[0];
+    float vl = volL.current, vr = volR.current;
 
-        // Apply master volume
-        l *= volL.current;
-        r *= volR.current;
-        
-        // Apply ear protection
-        assert(abs(l) < 1.0);
-        assert(abs(r) < 1.0);
-        
-        stream.write(SamplePair { l, r } );
+    for (isize i = 0, n; i < numSamples; i += n) {
+
+        n = std::min(numSamples - i, mixBlockSize);
+
+        // Convert sound samples to floating point values
+        convertSamples(sidStream[0], ch0, n, vol[0]);
+
+        // Write the block into the ringbuffer
+        for (isize j = 0, m; j < n; j += m) {
+
+            // Drop the remaining samples if the buffer is full
+            m = std::min(n - j, stream.contiguousFree());
+            if (m == 0) break;
+
+            SamplePair *dst = stream.writeAddr();
+            for (isize k = 0; k < m; k++) {
+
+                // Compute left and right channel output and apply master volume
+                float l = ch0[j + k] * pl * vl;
+                float r = ch0[j + k] * pr * vr;
+
+                // Apply ear protection
+                assert(abs(l) < 1.0);
+                assert(abs(r) < 1.0);
+
+                dst[k] = SamplePair { l, r };
+            }
+            stream.advanceWritePtr(m);
+        }
     }
-    stream.unlock();
 }
 
 void
 Muxer::mixMultiSID(isize numSamples)
 {
-    stream.lock();
-    
     // Check for buffer overflow
     if (stream.free() < numSamples) {
         handleBufferOverflow();
@@ -868,37 +992,53 @@ Muxer::mixMultiSID(isize numSamples)
     debug(SID_EXEC, "vol0: %f pan0: %f volL: %f volR: %f\n",
           vol[0], pan[0], volL.current, volR.current);
 
-    // Convert sound samples to floating point values and write into ringbuffer
-    for (isize i = 0; i < numSamples; i++) {
-        
-        float ch0, ch1, ch2, ch3, l, r;
-        
-        ch0 = (float)sidStream[0].read()  * vol[0];
-        ch1 = (float)sidStream[1].read(0) * vol[1];
-        ch2 = (float)sidStream[2].read(0) * vol[2];
-        ch3 = (float)sidStream[3].read(0) * vol[3];
-
-        // Compute left channel output
-        l =
-        ch0 * (1 - pan[0]) + ch1 * (1 - pan[1]) +
-        ch2 * (1 - pan[2]) + ch3 * (1 - pan[3]);
-
-        // Compute right channel output
-        r =
-        ch0 * pan[0] + ch1 * pan[1] +
-        ch2 * pan[2] + ch3 * pan[3];
-
-        // Apply master volume
-        l *= volL.current;
-        r *= volR.current;
-        
-        // Apply ear protection
-        assert(abs(l) < 1.0);
-        assert(abs(r) < 1.0);
-        
-        stream.write(SamplePair { l, r } );
+    float ch[4][mixBlockSize];
+    float pl[4], pr[4];
+    float vl = volL.current, vr = volR.current;
+
+    for (isize i = 0; i < 4; i++) { pl[i] = 1 - pan[i]; pr[i] = pan[i]; }
+
+    for (isize i = 0, n; i < numSamples; i += n) {
+
+        n = std::min(numSamples - i, mixBlockSize);
+
+        // Convert sound samples to floating point values
+        for (isize j = 0; j < 4; j++) convertSamples(sidStream[j], ch[j], n, vol[j]);
+
+        // Write the block into the ringbuffer
+        for (isize j = 0, m; j < n; j += m) {
+
+            // Drop the remaining samples if the buffer is full
+            m = std::min(n - j, stream.contiguousFree());
+            if (m == 0) break;
+
+            SamplePair *dst = stream.writeAddr();
+            for (isize k = 0; k < m; k++) {
+
+                float ch0 = ch[0][j + k];
+                float ch1 = ch[1][j + k];
+                float ch2 = ch[2][j + k];
+                float ch3 = ch[3][j + k];
+
+                // Compute left channel output
+                float l = ch0 * pl[0] + ch1 * pl[1] + ch2 * pl[2] + ch3 * pl[3];
+
+                // Compute right channel output
+                float r = ch0 * pr[0] + ch1 * pr[1] + ch2 * pr[2] + ch3 * pr[3];
+
+                // Apply master volume
+                l *= vl;
+                r *= vr;
+
+                // Apply ear protection
+                assert(abs(l) < 1.0);
+                assert(abs(r) < 1.0);
+
+                dst[k] = SamplePair { l, r };
+            }
+            stream.advanceWritePtr(m);
+        }
     }
-    stream.unlock();
 }
 
 void
@@ -929,13 +1069,15 @@ Muxer::handleBufferUnderflow()
     // (1) The consumer runs slightly faster than the producer.
     // (2) The producer is halted or not startet yet.
     
-    trace(AUDBUF_DEBUG, "BUFFER UNDERFLOW (r: %ld w: %ld)\n", stream.r, stream.w);
+    trace(AUDBUF_DEBUG, "BUFFER UNDERFLOW (r: %ld w: %ld)\n", isize(stream.r), isize(stream.w));
 
-    // Reset the write pointer
-    stream.alignWritePtr();
+    stream.underruns++;
+
+    // Reset the read pointer (the write pointer is owned by the producer)
+    stream.alignReadPtr();
     
     // Determine the elapsed seconds since the last pointer adjustment
-    auto elapsedTime = util::Time::now() - lastAlignment;
+    auto elapsedTime = util::Time::now() - lastAlignment.load();
     lastAlignment = util::Time::now();
     
     // Adjust the sample rate, if condition (1) holds
@@ -957,13 +1099,13 @@ Muxer::handleBufferOverflow()
     // (1) The consumer runs slightly slower than the producer
     // (2) The consumer is halted or not startet yet
     
-    trace(AUDBUF_DEBUG, "BUFFER OVERFLOW (r: %ld w: %ld)\n", stream.r, stream.w);
+    trace(AUDBUF_DEBUG, "BUFFER OVERFLOW (r: %ld w: %ld)\n", isize(stream.r), isize(stream.w));
 
     // Reset the write pointer
     stream.alignWritePtr();
     
     // Determine the number of elapsed seconds since the last adjustment
-    auto elapsedTime = util::Time::now() - lastAlignment;
+    auto elapsedTime = util::Time::now() - lastAlignment.load();
     lastAlignment = util::Time::now();
     trace(AUDBUF_DEBUG, "elapsedTime: %f\n", elapsedTime.asSeconds());
     
@@ -995,7 +1137,12 @@ Muxer::copyMono(float *target, isize n)
         return;
     }
     
-    stream.lock();
+    // Never wait for a buffer reset
+    if (!stream.tryLock()) {
+        stream.contentions++;
+        for (isize i = 0; i < n; i++) target[i] = 0.0;
+        return;
+    }
     
     // Check for a buffer underflow
     if (stream.count() < n) handleBufferUnderflow();
@@ -1014,7 +1161,12 @@ Muxer::copyStereo(float *target1, float *target2, isize n)
         return;
     }
 
-    stream.lock();
+    // Never wait for a buffer reset
+    if (!stream.tryLock()) {
+        stream.contentions++;
+        for (isize i = 0; i < n; i++) target1[i] = target2[i] = 0.0;
+        return;
+    }
     
     // Check for a buffer underflow
     if (stream.count() < n) handleBufferUnderflow();
@@ -1033,7 +1185,12 @@ Muxer::copyInterleaved(float *target, isize n)
         return;
     }
 
-    stream.lock();
+    // Never wait for a buffer reset
+    if (!stream.tryLock()) {
+        stream.contentions++;
+        for (isize i = 0; i < 2 * n; i++) target[i] = 0.0;
+        return;
+    }
     
     // Check for a buffer underflow
     if (stream.count() < n) handleBufferUnderflow();
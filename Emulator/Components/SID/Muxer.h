@@ -20,6 +20,8 @@
 #include "FastSID.h"
 #include "ReSID.h"
 #include "Chrono.h"
+#include <atomic>
+#include <thread>
 
 namespace vc64 {
 
@@ -48,6 +50,7 @@ namespace vc64 {
 class Muxer : public SubComponent {
 
     friend C64Memory;
+    friend class Benchmark;
 
     // Current configuration
     SIDConfig config = { };
@@ -87,8 +90,8 @@ private:
     // Sample rate (44.1 kHz per default)
     double sampleRate = 44100.0;
 
-    // Time stamp of the last write pointer alignment
-    util::Time lastAlignment;
+    // Time stamp of the last read or write pointer alignment
+    std::atomic<util::Time> lastAlignment;
 
     // Master volumes (fadable)
     Volume volL;
@@ -100,6 +103,30 @@ private:
     // Panning factors
     float pan[4] = { 0, 0, 0, 0 };
 
+    /* Worker threads for the additional SIDs. If parallel synthesis is
+     * enabled, SIDs 1 to 3 are emulated on separate host threads while the
+     * emulator thread emulates SID 0. Ownership of a SID is handed over to its
+     * worker when a chunk of cycles is to be synthesized and returned once all
+     * samples have been written into the SID stream. The streams are mixed
+     * after all workers have returned their SIDs. Short chunks, which occur
+     * when the CPU accesses a SID register, are emulated sequentially.
+     */
+    std::thread worker[4];
+
+    // Indicates which thread is allowed to emulate a SID
+    enum { OWNER_MUXER, OWNER_WORKER, OWNER_NONE };
+    std::atomic<int> owner[4] = { OWNER_MUXER, OWNER_MUXER, OWNER_MUXER, OWNER_MUXER };
+
+    // Number of cycles to emulate and number of produced samples per worker
+    isize jobCycles[4] = { };
+    isize jobSamples[4] = { };
+
+    // Minimum number of cycles for running the SIDs in parallel
+    static constexpr isize minParallelCycles = 1000;
+
+    // Number of samples the mixer processes in one block
+    static constexpr isize mixBlockSize = 256;
+
 public:
 
 
@@ -125,6 +152,7 @@ public:
 public:
 
     Muxer(C64 &ref);
+    ~Muxer();
 
     // Resets the output buffer
     void clear();
@@ -274,13 +302,13 @@ public:
 
     /* Handles a buffer underflow condition. A buffer underflow occurs when the
      * audio device of the host machine needs sound samples than SID hasn't
-     * produced, yet.
+     * produced, yet. This function is called by the consumer thread.
      */
     void handleBufferUnderflow();
     
     /* Handles a buffer overflow condition. A buffer overflow occurs when SID
      * is producing more samples than the audio device of the host machine is
-     * able to consume.
+     * able to consume. This function is called by the emulator thread.
      */
     void handleBufferOverflow();
     
@@ -297,6 +325,19 @@ public:
 
 private:
     
+    // Executes a single SID for a certain number of CPU cycles
+    isize synthesize(isize nr, isize numCycles);
+
+    // Hands a SID over to its worker thread and waits for the result
+    void dispatch(isize nr, isize numCycles);
+    isize join(isize nr);
+
+    // Manages the worker threads
+    void launchWorker(isize nr);
+    void haltWorker(isize nr);
+    void haltWorkers();
+    void runWorker(isize nr);
+
     // Called by executeCycles to produce the final stereo stream
     void mixSingleSID(isize numSamples);
     void mixMultiSID(isize numSamples);
@@ -13,6 +13,8 @@
 #include "config.h"
 #include "Muxer.h"
 
+#include <algorithm>
+
 namespace vc64 {
 
 void
@@ -21,6 +23,12 @@ StereoStream::alignWritePtr()
     this->align(this->cap() / 2);
 }
 
+void
+StereoStream::alignReadPtr()
+{
+    this->r = (this->w + this->cap() / 2) % this->cap();
+}
+
 void
 StereoStream::copyMono(float *buffer, isize n, Volume &volL, Volume &volR)
 {    
@@ -31,16 +39,25 @@ StereoStream::copyMono(float *buffer, isize n, Volume &volL, Volume &volR)
         
         for (isize i = 0; i < n; i++, volL.shift()) {
             
-            SamplePair pair = read();
+            SamplePair pair = current(); skip();
             *buffer++ = (pair.left + pair.right) * volL.current;
         }
 
     } else {
         
-        for (isize i = 0; i < n; i++) {
+        float vol = volL.current;
 
-            SamplePair pair = read();
-            *buffer++ = (pair.left + pair.right) * volL.current;
+        for (isize m; n > 0; n -= m, buffer += m) {
+
+            // Play silence if the buffer runs dry
+            if ((m = std::min(n, contiguousCount())) == 0) {
+                for (isize i = 0; i < n; i++) buffer[i] = 0.0f;
+                break;
+            }
+
+            const SamplePair *src = currentAddr();
+            for (isize i = 0; i < m; i++) buffer[i] = (src[i].left + src[i].right) * vol;
+            skip(m);
         }
     }
 }
@@ -58,18 +75,27 @@ StereoStream::copyStereo(float *left, float *right, isize n, Volume &volL, Volum
 
         for (isize i = 0; i < n; i++, volL.shift(), volR.shift()) {
             
-            SamplePair pair = read();
+            SamplePair pair = current(); skip();
             *left++ = pair.left * volL.current;
             *right++ = pair.right * volR.current;
         }
 
     } else {
         
-        for (isize i = 0; i < n; i++) {
+        float vl = volL.current, vr = volR.current;
 
-            SamplePair pair = read();
-            *left++ = pair.left * volL.current;
-            *right++ = pair.right * volR.current;
+        for (isize m; n > 0; n -= m, left += m, right += m) {
+
+            // Play silence if the buffer runs dry
+            if ((m = std::min(n, contiguousCount())) == 0) {
+                for (isize i = 0; i < n; i++) left[i] = right[i] = 0.0f;
+                break;
+            }
+
+            const SamplePair *src = currentAddr();
+            for (isize i = 0; i < m; i++) left[i] = src[i].left * vl;
+            for (isize i = 0; i < m; i++) right[i] = src[i].right * vr;
+            skip(m);
         }
     }
 }
@@ -84,18 +110,30 @@ StereoStream::copyInterleaved(float *buffer, isize n, Volume &volL, Volume &volR
 
         for (isize i = 0; i < n; i++, volL.shift()) {
             
-            SamplePair pair = read();
+            SamplePair pair = current(); skip();
             *buffer++ = pair.left * volL.current;
             *buffer++ = pair.right * volR.current;
         }
 
     } else {
         
-        for (isize i = 0; i < n; i++) {
+        float vl = volL.current, vr = volR.current;
 
-            SamplePair pair = read();
-            *buffer++ = pair.left * volL.current;
-            *buffer++ = pair.right * volR.current;
+        for (isize m; n > 0; n -= m, buffer += 2 * m) {
+
+            // Play silence if the buffer runs dry
+            if ((m = std::min(n, contiguousCount())) == 0) {
+                for (isize i = 0; i < 2 * n; i++) buffer[i] = 0.0f;
+                break;
+            }
+
+            const SamplePair *src = currentAddr();
+            for (isize i = 0; i < m; i++) {
+
+                buffer[2 * i] = src[i].left * vl;
+                buffer[2 * i + 1] = src[i].right * vr;
+            }
+            skip(m);
         }
     }
 }
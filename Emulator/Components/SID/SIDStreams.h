@@ -22,11 +22,26 @@ typedef util::RingBuffer<short, 2048> SampleStream;
 
 typedef struct { float left; float right; } SamplePair;
 
-class StereoStream : public util::RingBuffer < SamplePair, 12288 > {
+/* The stereo stream connects the emulator thread (producer) with the audio
+ * thread of the host (consumer). Samples are written and read without locking.
+ * The producer only moves the write pointer and the consumer only moves the
+ * read pointer. The mutex protects operations that reset the whole buffer.
+ * The consumer never waits for it. If the mutex is taken, it plays silence
+ * and records a contention.
+ */
+class StereoStream : public util::RingBuffer < SamplePair, 12288, util::SharedIndex > {
     
-    // Mutex for synchronizing read / write accesses
+    // Mutex for synchronizing buffer resets
     util::ReentrantMutex mutex;
 
+public:
+
+    // Number of read requests that could not be served from the buffer
+    std::atomic<i64> underruns = 0;
+
+    // Number of read requests that found the buffer locked
+    std::atomic<i64> contentions = 0;
+
 
     //
     // Synchronizing access
@@ -36,6 +51,7 @@ public:
 
     // Locks or unlocks the mutex
     void lock() { mutex.lock(); }
+    bool tryLock() { return mutex.tryLock(); }
     void unlock() { mutex.unlock(); }
 
     // Initializes the ring buffer with zeroes
@@ -44,9 +60,16 @@ public:
     // Adds a sample to the ring buffer
     void add(float l, float r) { this->write(SamplePair {l,r} ); }
 
-    // Puts the write pointer somewhat ahead of the read pointer
+    /* Puts the write pointer somewhat ahead of the read pointer. This function
+     * is called by the producer and only moves the write pointer.
+     */
     void alignWritePtr();
 
+    /* Puts the read pointer somewhat behind the write pointer. This function
+     * is called by the consumer and only moves the read pointer.
+     */
+    void alignReadPtr();
+
     
     //
     // Copying data
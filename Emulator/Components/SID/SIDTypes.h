@@ -122,6 +122,7 @@ typedef struct
     // Emlation engine settings
     SIDEngine engine;
     SamplingMethod sampling;
+    bool parallel;
     
     // Master volume (left and right channel)
     i64 volL;
@@ -143,6 +144,12 @@ typedef struct
 
     // Number of buffer overflows since power up
     u64 bufferOverflows;
+
+    // Number of audio requests that could not be served from the buffer
+    u64 underruns;
+
+    // Number of audio requests that found the buffer locked
+    u64 contentions;
 }
 SIDStats;
 
@@ -27,6 +27,19 @@
 #include "sid.h"
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#define RESID_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && defined(__x86_64__)
+#define RESID_HAVE_AVX2
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#define RESID_HAVE_NEON
+#include <arm_neon.h>
+#endif
+
 #include <iostream>
 #include <fstream>
 using namespace std;
@@ -53,6 +66,150 @@ inline short clip(int input)
     return (short)input;
 }
 
+
+// ----------------------------------------------------------------------------
+// Convolution kernels for the resampling FIR filter.
+//
+// The convolution dominates the run time of the resampling modes. Next to the
+// scalar reference, there are SSE2 and NEON kernels and an AVX2 kernel which
+// is selected at runtime if the host CPU supports it. All kernels sum up the
+// products with 32 bit integer arithmetic. Because the order of integer
+// additions does not matter, all kernels produce bit-identical results.
+// ----------------------------------------------------------------------------
+static int convolve_scalar(const short* a, const short* b, int n)
+{
+  int out = 0;
+  for (int i = 0; i < n; i++) {
+    out += a[i]*b[i];
+  }
+  return out;
+}
+
+#ifdef RESID_HAVE_SSE2
+static int convolve_sse2(const short* a, const short* b, int n)
+{
+  __m128i acc0 = _mm_setzero_si128();
+  __m128i acc1 = _mm_setzero_si128();
+
+  int i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i a0 = _mm_loadu_si128((const __m128i*)(a + i));
+    __m128i b0 = _mm_loadu_si128((const __m128i*)(b + i));
+    __m128i a1 = _mm_loadu_si128((const __m128i*)(a + i + 8));
+    __m128i b1 = _mm_loadu_si128((const __m128i*)(b + i + 8));
+    acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(a0, b0));
+    acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(a1, b1));
+  }
+
+  // Horizontal sum
+  __m128i acc = _mm_add_epi32(acc0, acc1);
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  return _mm_cvtsi128_si32(acc) + convolve_scalar(a + i, b + i, n - i);
+}
+#endif
+
+#ifdef RESID_HAVE_AVX2
+__attribute__((target("avx2")))
+static int convolve_avx2(const short* a, const short* b, int n)
+{
+  __m256i acc0 = _mm256_setzero_si256();
+  __m256i acc1 = _mm256_setzero_si256();
+
+  int i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i a0 = _mm256_loadu_si256((const __m256i*)(a + i));
+    __m256i b0 = _mm256_loadu_si256((const __m256i*)(b + i));
+    __m256i a1 = _mm256_loadu_si256((const __m256i*)(a + i + 16));
+    __m256i b1 = _mm256_loadu_si256((const __m256i*)(b + i + 16));
+    acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(a0, b0));
+    acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(a1, b1));
+  }
+
+  // Horizontal sum
+  __m256i sum = _mm256_add_epi32(acc0, acc1);
+  __m128i acc = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+  acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  return _mm_cvtsi128_si32(acc) + convolve_scalar(a + i, b + i, n - i);
+}
+#endif
+
+#ifdef RESID_HAVE_NEON
+static int convolve_neon(const short* a, const short* b, int n)
+{
+  int32x4_t acc0 = vdupq_n_s32(0);
+  int32x4_t acc1 = vdupq_n_s32(0);
+
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    int16x8_t a0 = vld1q_s16(a + i);
+    int16x8_t b0 = vld1q_s16(b + i);
+    acc0 = vmlal_s16(acc0, vget_low_s16(a0), vget_low_s16(b0));
+    acc1 = vmlal_high_s16(acc1, a0, b0);
+  }
+
+  return vaddvq_s32(vaddq_s32(acc0, acc1)) + convolve_scalar(a + i, b + i, n - i);
+}
+#endif
+
+static convolve_func select_convolve()
+{
+#ifdef RESID_HAVE_AVX2
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return convolve_avx2;
+  }
+#endif
+#if defined(RESID_HAVE_SSE2)
+  return convolve_sse2;
+#elif defined(RESID_HAVE_NEON)
+  return convolve_neon;
+#else
+  return convolve_scalar;
+#endif
+}
+
+static const convolve_func convolve = select_convolve();
+
+static const convolve_kernel* list_convolve()
+{
+  static convolve_kernel kernels[5];
+  int n = 0;
+
+  kernels[n++] = { "Scalar", convolve_scalar, false };
+#ifdef RESID_HAVE_SSE2
+  kernels[n++] = { "SSE2", convolve_sse2, false };
+#endif
+#ifdef RESID_HAVE_AVX2
+  if (__builtin_cpu_supports("avx2")) {
+    kernels[n++] = { "AVX2", convolve_avx2, false };
+  }
+#endif
+#ifdef RESID_HAVE_NEON
+  kernels[n++] = { "NEON", convolve_neon, false };
+#endif
+  kernels[n] = { 0, 0, false };
+
+  for (int i = 0; i < n; i++) {
+    kernels[i].selected = kernels[i].func == convolve;
+  }
+  return kernels;
+}
+
+static const convolve_kernel* const kernels = list_convolve();
+
+
+// ----------------------------------------------------------------------------
+// Convolution kernels supported by the host CPU.
+// ----------------------------------------------------------------------------
+const convolve_kernel* SID::convolve_kernels()
+{
+  return kernels;
+}
+
 // ----------------------------------------------------------------------------
 // Constructor.
 // ----------------------------------------------------------------------------
@@ -993,10 +1150,7 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
     short* sample_start = sample + sample_index - fir_N - 1 + RINGSIZE;
 
     // Convolution with filter impulse response.
-    int v1 = 0;
-    for (int j = 0; j < fir_N; j++) {
-      v1 += sample_start[j]*fir_start[j];
-    }
+    int v1 = convolve(sample_start, fir_start, fir_N);
 
     // Use next FIR table, wrap around to first FIR table using
     // next sample.
@@ -1007,10 +1161,7 @@ int SID::clock_resample(cycle_count& delta_t, short* buf, int n, int interleave)
     fir_start = fir + fir_offset*fir_N;
 
     // Convolution with filter impulse response.
-    int v2 = 0;
-    for (int k = 0; k < fir_N; k++) {
-      v2 += sample_start[k]*fir_start[k];
-    }
+    int v2 = convolve(sample_start, fir_start, fir_N);
 
     // Linear interpolation.
     // fir_offset_rmd is equal for all samples, it can thus be factorized out:
@@ -1059,10 +1210,7 @@ int SID::clock_resample_fastmem(cycle_count& delta_t, short* buf, int n, int int
     short* sample_start = sample + sample_index - fir_N + RINGSIZE;
 
     // Convolution with filter impulse response.
-    int v = 0;
-    for (int j = 0; j < fir_N; j++) {
-      v += sample_start[j]*fir_start[j];
-    }
+    int v = convolve(sample_start, fir_start, fir_N);
 
     v >>= FIR_SHIFT;
 
@@ -35,6 +35,16 @@
 namespace reSID
 {
 
+// Convolution kernel of the resampling FIR filter.
+typedef int (*convolve_func)(const short*, const short*, int);
+
+struct convolve_kernel
+{
+  const char* name;
+  convolve_func func;
+  bool selected;
+};
+
 class SID
 {
 public:
@@ -103,6 +113,10 @@ public:
 
   void debugoutput(void);
 
+  // Convolution kernels supported by the host CPU. The scalar reference
+  // comes first, and the list is terminated by an entry without a name.
+  static const convolve_kernel* convolve_kernels();
+
  public:
   static double I0(double x);
   int clock_fast(cycle_count& delta_t, short* buf, int n, int interleave);
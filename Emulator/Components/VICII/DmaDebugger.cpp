@@ -144,6 +144,7 @@ DmaDebugger::setConfigItem(Option option, i64 value)
         case OPT_CUT_LAYERS:
             
             config.cutLayers = (u16)value;
+            vic.updateVicFunctionTable();
             return;
             
         case OPT_CUT_OPACITY:
@@ -338,6 +338,9 @@ Recorder::prepare()
         samplesPerFrame = 735;
     }
     
+    // Make sure the first frame is copied entirely
+    recordedFrame = -1;
+
     // Start with a nearly empty buffer
     muxer.stream.lock();
     while (muxer.stream.count() > 1) muxer.stream.read();
@@ -364,18 +367,28 @@ Recorder::record()
 void
 Recorder::recordVideo()
 {
-    u32 *texture = (u32 *)vic.stableEmuTexture();
-    
+    u32 *texture = (u32 *)vic.latestEmuTexture();
+    const bool *dirty = vic.latestDirtyLines();
+    i64 frameNr = vic.getFrameSeq();
+
     isize width = sizeof(u32) * (cutout.x2 - cutout.x1);
     isize height = cutout.y2 - cutout.y1;
     isize offset = cutout.y1 * TEX_WIDTH + cutout.x1;
 
-    u8 *data = new u8[width * height];
+    // Copy all lines if the previous frame hasn't been recorded
+    bool full = frameNr != recordedFrame + 1 || frameData.size != width * height;
+    if (frameData.size != width * height) frameData.alloc(width * height);
+
+    u8 *data = frameData.ptr;
     u8 *src = (u8 *)(texture + offset);
     u8 *dst = data;
-    
-    for (isize y = 0; y < height; y++, src += 4 * TEX_WIDTH, dst += width) {
-        std::memcpy(dst, src, width);
+
+    if (frameNr != recordedFrame) {
+
+        for (isize y = 0; y < height; y++, src += 4 * TEX_WIDTH, dst += width) {
+            if (full || dirty[cutout.y1 + y]) std::memcpy(dst, src, width);
+        }
+        recordedFrame = frameNr;
     }
     
     // Feed the video pipe
@@ -16,6 +16,7 @@
 #include "Chrono.h"
 #include "FFmpeg.h"
 #include "NamedPipe.h"
+#include "Buffer.h"
 
 namespace vc64 {
 
@@ -60,6 +61,12 @@ class Recorder : public SubComponent {
     // The texture cutout that is going to be recorded
     struct { isize x1; isize y1; isize x2; isize y2; } cutout;
 
+    // The cutout of the most recently recorded frame
+    util::Buffer<u8> frameData;
+
+    // Sequence number of the most recently recorded frame
+    i64 recordedFrame = 0;
+
     // Time stamps
     util::Time recStart;
     util::Time recStop;
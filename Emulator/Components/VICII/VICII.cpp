@@ -68,28 +68,36 @@ VICII::_reset(bool hard)
         rightComparisonVal = rightComparisonValue();
         upperComparisonVal = upperComparisonValue();
         lowerComparisonVal = lowerComparisonValue();
-        
-        // Reset the screen buffer pointers
-        emuTexture = emuTexture1;
-        dmaTexture = dmaTexture1;
+    }
+}
+
+void
+VICII::resetEmuTextures()
+{
+    for (isize i = 0; i < 3; i++) {
+
+        resetEmuTexture(i);
+
+        // The consumer needs to redraw all lines
+        for (isize line = 0; line < TEX_HEIGHT; line++) dirtyLines[i][line] = true;
     }
 }
 
 void
 VICII::resetEmuTexture(isize nr)
 {
-    assert(nr == 1 || nr == 2);
+    assert(nr >= 0 && nr < 3);
 
-    if (nr == 1) { resetTexture(emuTexture1); }
-    if (nr == 2) { resetTexture(emuTexture2); }
+    resetTexture(emuTextures[nr]);
+    resetTexture(idxTextures[nr]);
 }
 
 void
 VICII::resetDmaTexture(isize nr)
 {
-    assert(nr == 1 || nr == 2);
+    assert(nr >= 0 && nr < 3);
     
-    u32 *p = nr == 1 ? dmaTexture1 : dmaTexture2;
+    u32 *p = dmaTextures[nr];
 
     for (int i = 0; i < TEX_HEIGHT * TEX_WIDTH; i++) {
         p[i] = 0xFF000000;
@@ -122,6 +130,49 @@ VICII::resetTexture(u32 *p)
     }
 }
 
+void
+VICII::resetTexture(u8 *p)
+{
+    // Determine the HBLANK / VBLANK area
+    long width = isPAL ? PAL_PIXELS : NTSC_PIXELS;
+    long height = getLinesPerFrame();
+
+    for (int y = 0; y < TEX_HEIGHT; y++) {
+        for (int x = 0; x < TEX_WIDTH; x++) {
+
+            int pos = y * TEX_WIDTH + x;
+
+            if (y < height && x < width) {
+
+                // Draw black pixels inside the used area
+                p[pos] = VICII_BLACK;
+
+            } else {
+
+                // Draw a checkerboard pattern outside the used area
+                p[pos] = (y / 4) % 2 == (x / 8) % 2 ? idxCheckerDark : idxCheckerLight;
+            }
+        }
+    }
+}
+
+void
+VICII::convertTexture(const u8 *src, u32 *dst, const bool *dirty) const
+{
+    for (isize y = 0; y < TEX_HEIGHT; y++, src += TEX_WIDTH, dst += TEX_WIDTH) {
+
+        if (dirty && !dirty[y]) continue;
+
+        for (isize x = 0; x < TEX_WIDTH; x += 4) {
+
+            dst[x + 0] = idxTable[src[x + 0]];
+            dst[x + 1] = idxTable[src[x + 1]];
+            dst[x + 2] = idxTable[src[x + 2]];
+            dst[x + 3] = idxTable[src[x + 3]];
+        }
+    }
+}
+
 VICIIConfig
 VICII::getDefaultConfig()
 {
@@ -129,6 +180,8 @@ VICII::getDefaultConfig()
     
     defaults.revision = VICII_PAL_8565;
     defaults.powerSave = true;
+    defaults.headless = false;
+    defaults.indexed = false;
     defaults.grayDotBug = true;
     defaults.glueLogic = GLUE_LOGIC_DISCRETE;
 
@@ -155,6 +208,8 @@ VICII::resetConfig()
 
         OPT_VIC_REVISION,
         OPT_VIC_POWER_SAVE,
+        OPT_VIC_HEADLESS,
+        OPT_VIC_INDEXED,
         OPT_GRAY_DOT_BUG,
         OPT_GLUE_LOGIC,
         OPT_PALETTE,
@@ -178,6 +233,8 @@ VICII::getConfigItem(Option option) const
             
         case OPT_VIC_REVISION:      return config.revision;
         case OPT_VIC_POWER_SAVE:    return config.powerSave;
+        case OPT_VIC_HEADLESS:      return config.headless;
+        case OPT_VIC_INDEXED:       return config.indexed;
         case OPT_PALETTE:           return config.palette;
         case OPT_BRIGHTNESS:        return config.brightness;
         case OPT_CONTRAST:          return config.contrast;
@@ -211,6 +268,18 @@ VICII::setConfigItem(Option option, i64 value)
             
             config.powerSave = bool(value);
             return;
+
+        case OPT_VIC_HEADLESS:
+
+            config.headless = bool(value);
+            updateVicFunctionTable();
+            return;
+
+        case OPT_VIC_INDEXED:
+
+            config.indexed = bool(value);
+            updateVicFunctionTable();
+            return;
             
         case OPT_PALETTE:
             
@@ -414,6 +483,10 @@ VICII::_dump(Category category, std::ostream& os) const
         os << VICIIRevisionEnum::key(config.revision) << std::endl;
         os << tab("Power save mode");
         os << bol(config.powerSave, "during warp", "never") << std::endl;
+        os << tab("Headless mode");
+        os << bol(config.headless) << std::endl;
+        os << tab("Indexed colors");
+        os << bol(config.indexed) << std::endl;
         os << tab("Gray dot bug");
         os << bol(config.grayDotBug) << std::endl;
         os << tab("PAL");
@@ -670,13 +743,53 @@ VICII::isVBlankLine(isize line) const
 u32 *
 VICII::stableEmuTexture() const
 {
-    return emuTexture == emuTexture1 ? emuTexture2 : emuTexture1;
+    // Pick up the published buffer if it contains a new frame
+    if (published.load(std::memory_order_relaxed) & freshFrame) {
+
+        auto buffer = published.exchange(stableBuffer, std::memory_order_acq_rel);
+        stableBuffer = buffer & 3;
+        stableTexturePalette = -1;
+    }
+
+    // Convert indexed frames (again if the palette has changed)
+    if (indexedFrame[stableBuffer]) {
+
+        if (auto version = paletteVersion.load(); stableTexturePalette != version) {
+
+            convertTexture(idxTextures[stableBuffer], emuTextures[stableBuffer]);
+            stableTexturePalette = version;
+        }
+    }
+    return emuTextures[stableBuffer];
+}
+
+u32 *
+VICII::latestEmuTexture() const
+{
+    if (!indexedFrame[latestBuffer]) return emuTextures[latestBuffer];
+
+    if (!latestTexture) latestTexture = new u32[TEX_HEIGHT * TEX_WIDTH];
+
+    auto nr = frameNr[latestBuffer];
+    auto version = paletteVersion.load();
+
+    if (nr != latestTextureNr || version != latestTexturePalette) {
+
+        // Only convert the changed lines if the previous frame is up to date
+        bool upToDate = nr == latestTextureNr + 1 && version == latestTexturePalette;
+        convertTexture(idxTextures[latestBuffer], latestTexture,
+                       upToDate ? dirtyLines[latestBuffer] : nullptr);
+
+        latestTextureNr = nr;
+        latestTexturePalette = version;
+    }
+    return latestTexture;
 }
 
 u32 *
 VICII::stableDmaTexture() const
 {
-    return dmaTexture == dmaTexture1 ? dmaTexture2 : dmaTexture1;
+    return dmaTextures[stableBuffer];
 }
 
 u32 *
@@ -1070,33 +1183,64 @@ VICII::beginFrame()
     
     // Check if this frame should be executed in headless mode
     headless = c64.isWarping() && config.powerSave && (c64.frame & 7) != 0;
+
+    // Lines that won't be drawn in this frame remain unchanged
+    for (isize line = 0; line < TEX_HEIGHT; line++) dirtyLines[workBuffer][line] = false;
 }
 
 void
 VICII::endFrame()
 {
     // Only proceed if the current frame hasn't been executed in headless mode
-    if (headless) return;
+    if (headless || isHeadless()) return;
+
+    // Keep the texture if the frame is an intermediate run-ahead frame
+    bool visible = c64.isVisibleFrame();
+    if (!visible && c64.isRunningAhead()) return;
     
     // Run the DMA debugger if enabled
     bool debug = dmaDebugger.config.dmaDebug;
     if (debug) dmaDebugger.computeOverlay(emuTexture, dmaTexture);
 
-    // Switch texture buffers
-    if (emuTexture == emuTexture1) {
-        
-        assert(dmaTexture == dmaTexture1);
-        emuTexture = emuTexture2;
-        dmaTexture = dmaTexture2;
-        if (debug) { resetEmuTexture(2); resetDmaTexture(2); }
+    // The overlay may have changed any line
+    if (debug) for (isize line = 0; line < TEX_HEIGHT; line++) dirtyLines[workBuffer][line] = true;
 
-    } else {
-        
-        assert(emuTexture == emuTexture2);
-        assert(dmaTexture == dmaTexture2);
-        emuTexture = emuTexture1;
-        dmaTexture = dmaTexture1;
-        if (debug) { resetEmuTexture(1); resetDmaTexture(1); }
+    // All lines change when switching between indexed and RGBA frames
+    indexedFrame[workBuffer] = drawIndexed;
+    if (drawIndexed != indexedFrame[latestBuffer]) {
+        for (isize line = 0; line < TEX_HEIGHT; line++) dirtyLines[workBuffer][line] = true;
+    }
+
+    /* Publish the working buffer and continue with the previously published
+     * one. A frame that is superseded by a run-ahead frame is published
+     * without flagging it fresh. It is handed over to the consumer in
+     * releaseFrame() if the run-ahead frame doesn't get published.
+     */
+    frameNr[workBuffer] = frameNr[latestBuffer] + 1;
+    latestBuffer = workBuffer;
+    auto buffer = published.exchange(workBuffer | (visible ? freshFrame : 0),
+                                     std::memory_order_acq_rel);
+    if (visible) frameSeq.store(frameNr[latestBuffer], std::memory_order_release);
+    frameHeld = !visible;
+
+    workBuffer = buffer & 3;
+    emuTexture = emuTextures[workBuffer];
+    dmaTexture = dmaTextures[workBuffer];
+    idxTexture = idxTextures[workBuffer];
+    if (debug) { resetEmuTexture(workBuffer); resetDmaTexture(workBuffer); }
+}
+
+void
+VICII::releaseFrame()
+{
+    if (!frameHeld) return;
+    frameHeld = false;
+
+    // Flag the frame fresh unless another frame has been published meanwhile
+    auto expected = latestBuffer;
+    if (published.compare_exchange_strong(expected, latestBuffer | freshFrame,
+                                          std::memory_order_acq_rel)) {
+        frameSeq.store(frameNr[latestBuffer], std::memory_order_release);
     }
 }
 
@@ -1155,6 +1299,7 @@ VICII::beginScanline()
     // Adjust the texture pointers
     emuTexturePtr = emuTexture + line * TEX_WIDTH;
     dmaTexturePtr = dmaTexture + line * TEX_WIDTH;
+    idxTexturePtr = idxTexture + line * TEX_WIDTH;
 
     // Determine if we're inside the VBLANK area
     vblank = isVBlankLine(line);
@@ -1181,6 +1326,16 @@ VICII::endScanline()
     // Cut out layers if requested
     dmaDebugger.cutLayers();
 
+    // Check if the scanline differs from the one in the previous frame
+    if (!headless && !isHeadless()) {
+
+        auto offset = c64.scanline * TEX_WIDTH;
+        auto diff = drawIndexed ?
+        std::memcmp(idxTexturePtr, idxTextures[latestBuffer] + offset, TEX_WIDTH) :
+        std::memcmp(emuTexturePtr, emuTextures[latestBuffer] + offset, TEX_WIDTH * sizeof(u32));
+        dirtyLines[workBuffer][c64.scanline] = diff != 0;
+    }
+
     // Prepare buffers for the next line
     for (isize i = 0; i < TEX_WIDTH; i++) { zBuffer[i] = 0; }
 }
@@ -26,6 +26,7 @@ class VICII : public SubComponent {
 
     friend class C64Memory;
     friend class DmaDebugger;
+    friend class Benchmark;
     
     // Current configuration
     VICIIConfig config = { };
@@ -55,7 +56,10 @@ public:
     typedef void (VICII::*ViciiFunc)(void);
     ViciiFunc vicfunc[66];
 
-    // Indicates if VICII is run in headless mode (skipping pixel synthesis)
+    /* Indicates if the current frame is executed without running the drawing
+     * routines (power-save mode in warp). Not to be confused with
+     * config.headless which selects a function table without pixel synthesis.
+     */
     bool headless = false;
     
     
@@ -388,7 +392,9 @@ private:
      */
     u8 cleared_bits_in_d017;
     
-    // Collision bits
+    /* Collision bits. For each sprite, a bit mask of the pixels covered in
+     * the current cycle (bit n corresponds to pixel n).
+     */
     u8 collision[8];
     
     
@@ -499,34 +505,106 @@ private:
     
     // C64 colors in RGBA format (updated in updatePalette())
     u32 rgbaTable[16];
+
+    /* Lookup table for converting indexed textures to RGBA (updated in
+     * updatePalette()). Entries 0 to 15 hold the C64 colors and the entries
+     * idxCheckerDark and idxCheckerLight the colors of the checkerboard
+     * pattern outside the used texture area.
+     */
+    u32 idxTable[256];
+    static constexpr u8 idxCheckerDark = 16;
+    static constexpr u8 idxCheckerLight = 17;
+
+    // Incremented whenever the color palette changes
+    std::atomic<i64> paletteVersion = 0;
     
     // Buffer storing background noise (random black and white pixels)
     u32 *noise;
 
     /* Texture buffers. VICII outputs the generated texture into these buffers.
-     * At any time, one buffer is the working buffer and the other one is the
-     * stable buffer. While VICII always writes into the working buffer, the
-     * GUI accesses the stable buffer at a constant frame rate and copies it
-     * into the texture RAM of the graphics card.
+     * The buffers are organized as a triple buffer. At any time, one buffer is
+     * the working buffer VICII draws into, one buffer holds the most recently
+     * published frame, and one buffer is held by the consumer (usually the
+     * GUI) which copies it into the texture RAM of the graphics card. When a
+     * frame is complete, VICII swaps the working buffer with the published
+     * buffer. The consumer swaps its buffer with the published buffer if a
+     * newer frame is available. Hence, neither side ever waits for the other
+     * one and the consumer never sees a partially drawn frame.
      *
      * The emuTexture buffers contain the emulator texture. It is the texture
      * that is usually drawn by the GUI. The dmaTexture buffers contain the
      * texture generated by the DMA debugger. If DMA debugging is enabled, this
      * texture is superimposed on the emulator texture.
+     *
+     * In indexed mode, VICII writes color indices into the idxTexture buffers
+     * instead of writing RGBA values into the emuTexture buffers. The indices
+     * are converted to RGBA when a consumer requests the texture.
+     */
+    u32 *emuTextures[3] = {
+        new u32[TEX_HEIGHT * TEX_WIDTH],
+        new u32[TEX_HEIGHT * TEX_WIDTH],
+        new u32[TEX_HEIGHT * TEX_WIDTH] };
+    u32 *dmaTextures[3] = {
+        new u32[TEX_HEIGHT * TEX_WIDTH],
+        new u32[TEX_HEIGHT * TEX_WIDTH],
+        new u32[TEX_HEIGHT * TEX_WIDTH] };
+    u8 *idxTextures[3] = {
+        new u8[TEX_HEIGHT * TEX_WIDTH],
+        new u8[TEX_HEIGHT * TEX_WIDTH],
+        new u8[TEX_HEIGHT * TEX_WIDTH] };
+
+    // Indicates whether a buffer contains an indexed frame
+    bool indexedFrame[3] = { };
+
+    // Indicates whether VICII currently draws indexed frames
+    bool drawIndexed = false;
+
+    // RGBA version of the latest published frame (indexed mode only)
+    mutable u32 *latestTexture = nullptr;
+    mutable i64 latestTextureNr = -1;
+    mutable i64 latestTexturePalette = -1;
+
+    // Palette version used for converting the stable texture
+    mutable i64 stableTexturePalette = -1;
+
+    // Frame sequence number of the frame stored in each buffer
+    i64 frameNr[3] = { };
+
+    /* The published buffer. Bits 0 and 1 contain the buffer index. Bit 2 is
+     * set if the buffer contains a frame the consumer hasn't picked up yet.
      */
-    u32 *emuTexture1 = new u32[TEX_HEIGHT * TEX_WIDTH];
-    u32 *emuTexture2 = new u32[TEX_HEIGHT * TEX_WIDTH];
-    u32 *dmaTexture1 = new u32[TEX_HEIGHT * TEX_WIDTH];
-    u32 *dmaTexture2 = new u32[TEX_HEIGHT * TEX_WIDTH];
-    /*
+    mutable std::atomic<isize> published = 1;
+    static constexpr isize freshFrame = 4;
+
+    // Index of the working buffer (owned by the emulator thread)
+    isize workBuffer = 0;
+
+    // Index of the buffer held by the consumer (owned by the consumer)
+    mutable isize stableBuffer = 2;
+
+    // Index of the most recently published buffer (owned by the emulator thread)
+    isize latestBuffer = 1;
+
+    // Sequence number of the most recently published frame
+    std::atomic<i64> frameSeq = 0;
+
+    // Indicates whether the latest buffer hasn't been flagged fresh yet
+    bool frameHeld = false;
+
+    /* Dirty line flags. For each buffer, these flags indicate which scanlines
+     * differ from the frame that has been published before. A flag is updated
+     * at the end of each scanline by comparing the drawn line with the same
+     * line in the most recently published buffer.
      */
+    bool dirtyLines[3][TEX_HEIGHT] = { };
 
-    /* Pointer to the current working texture. This variable points either to
-     * the first or the second texture buffer. After a frame has been finished,
-     * the pointer is redirected to the other buffer.
+    /* Pointer to the current working texture. This variable points to the
+     * working buffer. After a frame has been finished, the pointer is
+     * redirected to the new working buffer.
      */
-    u32 *emuTexture;
-    u32 *dmaTexture;
+    u32 *emuTexture = emuTextures[0];
+    u32 *dmaTexture = dmaTextures[0];
+    u8 *idxTexture = idxTextures[0];
 
     /* Pointer to the beginning of the current scanline inside the current
      * working textures. These pointers are used by all rendering methods to
@@ -536,6 +614,7 @@ private:
      */
     u32 *emuTexturePtr;
     u32 *dmaTexturePtr;
+    u8 *idxTexturePtr;
 
     /* VICII utilizes a depth buffer to determine pixel priority. The render
      * routines only write a color value, if it is closer to the view point.
@@ -584,13 +663,20 @@ public:
 private:
     
     void resetEmuTexture(isize nr);
-    void resetEmuTextures() { resetEmuTexture(1); resetEmuTexture(2); }
+    void resetEmuTextures();
     void resetDmaTexture(isize nr);
-    void resetDmaTextures() { resetDmaTexture(1); resetDmaTexture(2); }
+    void resetDmaTextures() { for (isize i = 0; i < 3; i++) resetDmaTexture(i); }
     void resetTexture(u32 *p);
+    void resetTexture(u8 *p);
+
+    // Converts the dirty lines of an indexed texture to RGBA (all if null)
+    void convertTexture(const u8 *src, u32 *dst, const bool *dirty = nullptr) const;
 
     template <u16 flags> ViciiFunc getViciiFunc(isize cycle);
 
+    // Assigns the execution functions for a range of cycles
+    template <u16 flags> void assignViciiFuncs(isize first, isize last);
+
     
     //
     // Methods from CoreObject
@@ -725,6 +811,9 @@ public:
 
     bool dmaDebug() const { return dmaDebugger.config.dmaDebug; }
 
+    // Checks if the headless function table is in use (see assignViciiFuncs)
+    bool isHeadless() const { return config.headless && !dmaDebug(); }
+
 private:
     
     void setRevision(VICIIRevision revision);
@@ -794,9 +883,32 @@ public:
     // Accessing the screen buffer and display properties
     //
     
-    // Returns pointers to the stable textures
+    /* Returns pointers to the stable textures. These functions are meant to
+     * be called by a single consumer outside the emulator thread (usually the
+     * GUI). They hand over the most recently published frame and keep it
+     * unmodified until the next call.
+     */
     u32 *stableEmuTexture() const;
     u32 *stableDmaTexture() const;
+
+    // Returns the sequence number of the frame in the stable textures
+    i64 stableFrameNr() const { return frameNr[stableBuffer]; }
+
+    /* Returns the dirty line flags of the stable textures. A flag is set if
+     * the scanline differs from the frame with the preceding sequence number.
+     * If frames have been skipped, all lines need to be considered dirty.
+     */
+    const bool *stableDirtyLines() const { return dirtyLines[stableBuffer]; }
+
+    /* Returns a pointer to the most recently published emulator texture. This
+     * function is meant to be called inside the emulator thread or while the
+     * emulator is suspended.
+     */
+    u32 *latestEmuTexture() const;
+    const bool *latestDirtyLines() const { return dirtyLines[latestBuffer]; }
+
+    // Returns the sequence number of the most recently published frame
+    i64 getFrameSeq() const { return frameSeq.load(std::memory_order_acquire); }
     
     // Returns a pointer to randon noise
     u32 *getNoise() const;
@@ -1136,6 +1248,12 @@ public:
      * each frame.
      */
     void endFrame();
+
+    /* Hands over a frame that has been held back for a run-ahead frame. This
+     * function is called after the run-ahead frames have been emulated or
+     * skipped. It does nothing if the run-ahead frame has been published.
+     */
+    void releaseFrame();
     
     /* Processes all time delayed actions. This function is called at the
      * beginning of each VICII cycle.
@@ -1206,26 +1324,33 @@ public:
     void cycle64ntsc();
     void cycle65ntsc();
 
+/* The drawing routines only depend on the HEADLESS_CYCLE and INDEXED_CYCLE
+ * flags. Headless cycles run the sequencers even in power-save frames,
+ * because collision detection depends on them.
+ */
+#define DRAW_FLAGS (flags & (HEADLESS_CYCLE | INDEXED_CYCLE))
+#define DRAWING (bool(flags & HEADLESS_CYCLE) || !headless)
+
 #define DRAW_SPRITES_DMA1 \
 assert(isFirstDMAcycle); assert(!isSecondDMAcycle); \
-if (!headless) { drawSpritesSlowPath(); }
+if (DRAWING) { drawSpritesSlowPath <DRAW_FLAGS> (); }
 
 #define DRAW_SPRITES_DMA2 \
 assert(!isFirstDMAcycle); assert(isSecondDMAcycle); \
-if (!headless) { drawSpritesSlowPath(); }
+if (DRAWING) { drawSpritesSlowPath <DRAW_FLAGS> (); }
 
 #define DRAW_SPRITES \
 assert(!isFirstDMAcycle && !isSecondDMAcycle); \
-if (spriteDisplay && !headless) { drawSprites(); }
+if (spriteDisplay && DRAWING) { drawSprites <DRAW_FLAGS> (); }
     
 #define DRAW_SPRITES59 \
-if ((spriteDisplayDelayed || spriteDisplay || isSecondDMAcycle) && !headless) \
-{ drawSpritesSlowPath(); }
+if ((spriteDisplayDelayed || spriteDisplay || isSecondDMAcycle) && DRAWING) \
+{ drawSpritesSlowPath <DRAW_FLAGS> (); }
     
-#define DRAW   if (!vblank && !headless) { drawCanvas(); drawBorder(); };
-#define DRAW17 if (!vblank && !headless) { drawCanvas(); drawBorder17(); };
-#define DRAW55 if (!vblank && !headless) { drawCanvas(); drawBorder55(); };
-#define DRAW59 if (!vblank && !headless) { drawCanvas(); drawBorder(); };
+#define DRAW   if (!vblank && DRAWING) { drawCanvas <DRAW_FLAGS> (); drawBorder <DRAW_FLAGS> (); };
+#define DRAW17 if (!vblank && DRAWING) { drawCanvas <DRAW_FLAGS> (); drawBorder17 <DRAW_FLAGS> (); };
+#define DRAW55 if (!vblank && DRAWING) { drawCanvas <DRAW_FLAGS> (); drawBorder55 <DRAW_FLAGS> (); };
+#define DRAW59 if (!vblank && DRAWING) { drawCanvas <DRAW_FLAGS> (); drawBorder <DRAW_FLAGS> (); };
 
 #define END_CYCLE \
 dataBusPhi2 = 0xFF; \
@@ -1242,25 +1367,37 @@ END_CYCLE
     //
     // Drawing routines (VIC_draw.cpp)
     //
-    
+
+    /* All drawing routines are instantiated three times. If HEADLESS_CYCLE is
+     * set, no pixels are synthesized. Only the sequencers are run and the
+     * depth buffer is updated, which is needed for collision detection. If
+     * INDEXED_CYCLE is set, color indices are written instead of RGBA values.
+     */
+
 private:
 
     // Draws 8 border pixels. Invoked inside draw().
-    void drawBorder();
+    template <u16 flags> void drawBorder();
     
     // Draws the border pixels in cycle 17
-    void drawBorder17();
+    template <u16 flags> void drawBorder17();
     
     // Draws the border pixels in cycle 55
-    void drawBorder55();
+    template <u16 flags> void drawBorder55();
     
     // Draws 8 canvas pixels
-    void drawCanvas();
-    void drawCanvasFastPath();
-    void drawCanvasSlowPath();
+    template <u16 flags> void drawCanvas();
+    template <u16 flags> void drawCanvasFastPath();
+    template <u16 flags> void drawCanvasSlowPath();
+
+    // Fast path helpers (pixel by pixel or a whole shift register byte at once)
+    template <u16 flags> void drawCanvasPixels();
+    template <u16 flags> void drawCanvasByte();
+    template <u16 flags> void drawHiresByte(u8 data, u8 fg, u8 bg);
+    template <u16 flags> void drawMulticolorByte(u8 data, u8 c0, u8 c1, u8 c2, u8 c3);
 
     // Draws a single canvas pixel
-    void drawCanvasPixel(u8 pixel, u8 mode, u8 d016);
+    template <u16 flags> void drawCanvasPixel(u8 pixel, u8 mode, u8 d016);
     
     // Reloads the sequencer shift register with the gAccess result
     void loadShiftRegister();
@@ -1272,14 +1409,16 @@ private:
 private:
     
     // Draws 8 sprite pixels (see draw())
-    void drawSprites();
-    void drawSpritesFastPath();
-    void drawSpritesSlowPath();
+    template <u16 flags> void drawSprites();
+    template <u16 flags> void drawSpritesFastPath();
+    template <u16 flags> void drawSpritesSlowPath();
     
     /* Draws all sprite pixels for a single sprite. This function is used when
      * the fast path is taken.
+     *
+     *      occupied : pixels drawn by sprites with higher priority
      */
-    template <bool multicolor> void drawSpriteNr(isize nr, bool enable, bool active);
+    template <u16 flags, bool multicolor> void drawSpriteNr(isize nr, bool enable, bool active, u8 occupied);
 
     /* Draws a single sprite pixel for all sprites. This function is used when
      * the slow path is taken.
@@ -1288,7 +1427,10 @@ private:
      *    enableBits : the spriteDisplay bits
      *    freezeBits : forces the sprites shift register to freeze temporarily
      */
-    void drawSpritePixel(isize pixel, u8 enableBits, u8 freezeBits);
+    template <u16 flags> void drawSpritePixel(isize pixel, u8 enableBits, u8 freezeBits);
+
+    // Returns the sprites whose shift register starts in the current cycle
+    u8 spriteTriggers() const;
 
     // Performs collision detection
     void checkCollisions();
@@ -1298,9 +1440,10 @@ private:
     // Low level drawing (pixel buffer access)
     //
     
-    // Writes a single color value into the screenbuffer
+    // Writes a single color value into the screenbuffer (skipped if headless)
 #define COLORIZE(index,color) \
-emuTexturePtr[index] = rgbaTable[color];
+if constexpr (bool(flags & INDEXED_CYCLE)) { idxTexturePtr[index] = u8(color); } \
+else if constexpr (!(flags & HEADLESS_CYCLE)) { emuTexturePtr[index] = rgbaTable[color]; }
     
     // Sets a single frame pixel
 #define SET_FRAME_PIXEL(pixel,color) { \
@@ -1320,11 +1463,12 @@ isize index = bufferoffset + pixel; \
 COLORIZE(index,color) \
 zBuffer[index] = DEPTH_BG; }
     
-    // Sets a single sprite pixel
-#define SET_SPRITE_PIXEL(sprite,pixel,color) { \
+    // Sets a single sprite pixel (the depth only matters for visible pixels)
+#define SET_SPRITE_PIXEL(sprite,pixel,color) \
+if constexpr (!(flags & HEADLESS_CYCLE)) { \
 isize index = bufferoffset + pixel; \
 if (u8 depth = spriteDepth(sprite); depth <= zBuffer[index]) { \
-if (isVisibleColumn) COLORIZE(index, color); \
+if (isVisibleColumn) { COLORIZE(index, color); } \
 zBuffer[index] = depth | (zBuffer[index] & 0x10); \
 } }
 
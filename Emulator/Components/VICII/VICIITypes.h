@@ -38,6 +38,7 @@ static const u16 PAL_CYCLE      = 0b0001;
 static const u16 NTSC_CYCLE     = 0b0010;
 static const u16 DEBUG_CYCLE    = 0b0100;
 static const u16 HEADLESS_CYCLE = 0b1000;
+static const u16 INDEXED_CYCLE  = 0b10000;
 
 /* Depths of different drawing layers
  *
@@ -353,6 +354,8 @@ typedef struct
     // Silicon
     VICIIRevision revision;
     bool powerSave;
+    bool headless;
+    bool indexed;
     bool grayDotBug;
     GlueLogic glueLogic;
     
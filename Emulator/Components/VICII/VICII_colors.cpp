@@ -255,6 +255,14 @@ VICII::updatePalette()
     for (isize i = 0; i < 16; i++) {
         rgbaTable[i] = getColor(i, config.palette);
     }
+
+    // Update the lookup table for indexed textures
+    for (isize i = 0; i < 256; i++) {
+        idxTable[i] = i < 16 ? rgbaTable[i] : 0xFF000000;
+    }
+    idxTable[idxCheckerDark] = 0xFF222222;
+    idxTable[idxCheckerLight] = 0xFF444444;
+    paletteVersion++;
 }
 
 }
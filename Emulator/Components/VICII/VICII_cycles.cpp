@@ -49,7 +49,7 @@ VICII::cycle1()
     }
     
     // Phi1.2 Draw sprites (invisible area)
-    if (!headless) drawSpritesSlowPath();
+    if (DRAWING) drawSpritesSlowPath <DRAW_FLAGS> ();
 
     // Phi1.3 Fetch
     PAL  { sFinalize(2); pAccess <flags> (3); }
@@ -1220,4 +1220,128 @@ template void VICII::cycle63<NTSC_CYCLE | DEBUG_CYCLE>();
 template void VICII::cycle64<NTSC_CYCLE | DEBUG_CYCLE>();
 template void VICII::cycle65<NTSC_CYCLE | DEBUG_CYCLE>();
 
+template void VICII::cycle1<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle2<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle3<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle4<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle5<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle6<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle7<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle8<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle9<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle10<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle11<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle12<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle13<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle14<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle15<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle16<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle17<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle18<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle19to54<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle55<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle56<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle57<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle58<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle59<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle60<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle61<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle62<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle63<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle64<PAL_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle65<PAL_CYCLE | HEADLESS_CYCLE>();
+
+template void VICII::cycle1<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle2<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle3<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle4<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle5<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle6<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle7<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle8<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle9<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle10<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle11<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle12<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle13<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle14<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle15<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle16<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle17<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle18<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle19to54<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle55<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle56<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle57<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle58<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle59<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle60<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle61<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle62<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle63<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle64<NTSC_CYCLE | HEADLESS_CYCLE>();
+template void VICII::cycle65<NTSC_CYCLE | HEADLESS_CYCLE>();
+
+template void VICII::cycle1<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle2<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle3<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle4<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle5<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle6<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle7<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle8<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle9<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle10<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle11<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle12<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle13<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle14<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle15<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle16<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle17<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle18<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle19to54<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle55<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle56<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle57<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle58<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle59<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle60<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle61<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle62<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle63<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle64<PAL_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle65<PAL_CYCLE | INDEXED_CYCLE>();
+
+template void VICII::cycle1<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle2<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle3<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle4<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle5<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle6<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle7<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle8<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle9<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle10<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle11<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle12<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle13<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle14<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle15<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle16<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle17<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle18<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle19to54<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle55<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle56<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle57<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle58<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle59<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle60<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle61<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle62<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle63<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle64<NTSC_CYCLE | INDEXED_CYCLE>();
+template void VICII::cycle65<NTSC_CYCLE | INDEXED_CYCLE>();
+
 }
@@ -13,10 +13,45 @@
 #include "config.h"
 #include "VICII.h"
 #include "C64.h"
+#include <array>
+#include <bit>
+#include <cstring>
 
 namespace vc64 {
 
-void
+// Replicates a byte into all eight bytes of a 64 bit word
+static constexpr u64 splat(u8 value) { return u64(value) * 0x0101010101010101; }
+
+/* Pixel masks of a shift register byte. Each table entry holds eight mask
+ * bytes, one per pixel in drawing order. A mask byte is 0xFF if the pixel
+ * belongs to the foreground. In multicolor mode, two adjacent pixels share
+ * the same bit pair and belong to the foreground if the upper bit is set.
+ */
+static constexpr auto hiresMasks = []() {
+
+    std::array<u64, 256> result { };
+    for (isize i = 0; i < 256; i++) {
+
+        std::array<u8, 8> mask { };
+        for (isize j = 0; j < 8; j++) mask[j] = (i & (0x80 >> j)) ? 0xFF : 0x00;
+        result[i] = std::bit_cast<u64>(mask);
+    }
+    return result;
+}();
+
+static constexpr auto multicolorMasks = []() {
+
+    std::array<u64, 256> result { };
+    for (isize i = 0; i < 256; i++) {
+
+        std::array<u8, 8> mask { };
+        for (isize j = 0; j < 8; j++) mask[j] = (i & (0x80 >> (j & ~1))) ? 0xFF : 0x00;
+        result[i] = std::bit_cast<u64>(mask);
+    }
+    return result;
+}();
+
+template <u16 flags> void
 VICII::drawBorder()
 {
     if (flipflops.delayed.main) {
@@ -29,7 +64,7 @@ VICII::drawBorder()
     }
 }
 
-void
+template <u16 flags> void
 VICII::drawBorder17()
 {
     if (flipflops.delayed.main && !flipflops.current.main) {
@@ -43,11 +78,11 @@ VICII::drawBorder17()
     } else {
         
         // 40 column mode (all eight pixels are drawn)
-        drawBorder();
+        drawBorder <flags> ();
     }
 }
 
-void
+template <u16 flags> void
 VICII::drawBorder55()
 {
     if (!flipflops.delayed.main && flipflops.current.main) {
@@ -57,25 +92,44 @@ VICII::drawBorder55()
         
     } else {
         
-        drawBorder();
+        drawBorder <flags> ();
     }
 }
 
-void
+template <u16 flags> void
 VICII::drawCanvas()
 {
     if ((delay & VICUpdateRegisters) || VIC_SAFE_MODE == 1) {
-        drawCanvasSlowPath();
+        drawCanvasSlowPath <flags> ();
     } else {
-        drawCanvasFastPath();
+        drawCanvasFastPath <flags> ();
     }
 }
 
-void
+template <u16 flags> void
 VICII::drawCanvasFastPath()
 {
     if (VIC_STATS) stats.canvasFastPath++;
     
+    /* If the shift register is reloaded with the first pixel, all eight pixels
+     * are synthesized from the same byte and can be drawn in one go. This is
+     * the common case. Otherwise, the pixels are drawn one by one.
+     */
+    if (reg.delayed.xscroll == 0 &&
+        reg.delayed.mode <= DISPLAY_MODE_EXTENDED_BG_COLOR &&
+        !flipflops.delayed.vertical && sr.canLoad) {
+        
+        drawCanvasByte <flags> ();
+        
+    } else {
+        
+        drawCanvasPixels <flags> ();
+    }
+}
+
+template <u16 flags> void
+VICII::drawCanvasPixels()
+{
     u8 xscroll = reg.delayed.xscroll;
     
     switch (reg.delayed.mode) {
@@ -191,12 +245,125 @@ VICII::drawCanvasFastPath()
         default:
             
             // Invalid color modes (no speedup necessary)
-            drawCanvasSlowPath();
+            drawCanvasSlowPath <flags> ();
             break;
     }
 }
 
-void
+template <u16 flags> void
+VICII::drawCanvasByte()
+{
+    loadShiftRegister();
+    
+    u8 data = sr.data;
+    auto &colors = reg.delayed.colors;
+    
+    switch (reg.delayed.mode) {
+            
+        case DISPLAY_MODE_STANDARD_TEXT:
+            
+            drawHiresByte <flags> (data, sr.latchedCol, colors[COLREG_BG0]);
+            break;
+            
+        case DISPLAY_MODE_MULTICOLOR_TEXT:
+            
+            if (sr.latchedCol & 0x8) {
+                drawMulticolorByte <flags> (data,
+                                            colors[COLREG_BG0],
+                                            colors[COLREG_BG1],
+                                            colors[COLREG_BG2],
+                                            sr.latchedCol & 0x07);
+            } else {
+                drawHiresByte <flags> (data, sr.latchedCol, colors[COLREG_BG0]);
+            }
+            break;
+            
+        case DISPLAY_MODE_STANDARD_BITMAP:
+            
+            drawHiresByte <flags> (data, HI_NIBBLE(sr.latchedChr), LO_NIBBLE(sr.latchedChr));
+            break;
+            
+        case DISPLAY_MODE_MULTICOLOR_BITMAP:
+            
+            drawMulticolorByte <flags> (data,
+                                        colors[COLREG_BG0],
+                                        HI_NIBBLE(sr.latchedChr),
+                                        LO_NIBBLE(sr.latchedChr),
+                                        sr.latchedCol);
+            break;
+            
+        case DISPLAY_MODE_EXTENDED_BG_COLOR:
+            
+            drawHiresByte <flags> (data, sr.latchedCol, colors[COLREG_BG0 + (sr.latchedChr >> 6)]);
+            break;
+            
+        default:
+            fatalError;
+    }
+    
+    // All bits have been shifted out. The mc flipflop has toggled eight times
+    sr.data = 0;
+}
+
+template <u16 flags> void
+VICII::drawHiresByte(u8 data, u8 fg, u8 bg)
+{
+    u64 mask = hiresMasks[data];
+    
+    // Write all eight depth values at once
+    u64 depth = splat(DEPTH_BG) ^ (mask & splat(DEPTH_BG ^ DEPTH_FG));
+    std::memcpy(zBuffer + bufferoffset, &depth, 8);
+    
+    if constexpr (bool(flags & INDEXED_CYCLE)) {
+        
+        u64 pixels = splat(bg) ^ (mask & splat(bg ^ fg));
+        std::memcpy(idxTexturePtr + bufferoffset, &pixels, 8);
+        
+    } else if constexpr (!(flags & HEADLESS_CYCLE)) {
+        
+        // Blend the two colors with the widened masks (vectorizes well)
+        i8 m[8]; std::memcpy(m, &mask, 8);
+        u32 bgColor = rgbaTable[bg];
+        u32 diff = bgColor ^ rgbaTable[fg];
+        u32 *ptr = emuTexturePtr + bufferoffset;
+        
+        for (isize i = 0; i < 8; i++) ptr[i] = bgColor ^ (diff & u32(i32(m[i])));
+    }
+    
+    sr.colorbits = data & 0x1;
+}
+
+template <u16 flags> void
+VICII::drawMulticolorByte(u8 data, u8 c0, u8 c1, u8 c2, u8 c3)
+{
+    u64 mask = multicolorMasks[data];
+    
+    // Write all eight depth values at once
+    u64 depth = splat(DEPTH_BG) ^ (mask & splat(DEPTH_BG ^ DEPTH_FG));
+    std::memcpy(zBuffer + bufferoffset, &depth, 8);
+    
+    if constexpr (!(flags & HEADLESS_CYCLE)) {
+        
+        const u8 colors[4] = { c0, c1, c2, c3 };
+        
+        for (isize i = 0; i < 4; i++) {
+            
+            u8 color = colors[(data >> (6 - 2 * i)) & 0x3];
+            
+            if constexpr (bool(flags & INDEXED_CYCLE)) {
+                idxTexturePtr[bufferoffset + 2 * i] = color;
+                idxTexturePtr[bufferoffset + 2 * i + 1] = color;
+            } else {
+                emuTexturePtr[bufferoffset + 2 * i] = rgbaTable[color];
+                emuTexturePtr[bufferoffset + 2 * i + 1] = rgbaTable[color];
+            }
+        }
+    }
+    
+    sr.colorbits = data & 0x3;
+}
+
+template <u16 flags> void
 VICII::drawCanvasSlowPath()
 {
     if (VIC_STATS) stats.canvasSlowPath++;
@@ -215,7 +382,7 @@ VICII::drawCanvasSlowPath()
     // Pixel 0
     //
     
-    drawCanvasPixel(0, mode, d016);
+    drawCanvasPixel <flags> (0, mode, d016);
     
     // After the first pixel, color register changes show up
     reg.delayed.colors[COLREG_BG0] = reg.current.colors[COLREG_BG0];
@@ -227,9 +394,9 @@ VICII::drawCanvasSlowPath()
     // Pixel 1, 2, 3
     //
     
-    drawCanvasPixel(1, mode, d016);
-    drawCanvasPixel(2, mode, d016);
-    drawCanvasPixel(3, mode, d016);
+    drawCanvasPixel <flags> (1, mode, d016);
+    drawCanvasPixel <flags> (2, mode, d016);
+    drawCanvasPixel <flags> (3, mode, d016);
     
     /* After pixel 4, a change in D016 affects the display mode. In older
      * VICIIs, the one bits of D011 show up, too.
@@ -242,8 +409,8 @@ VICII::drawCanvasSlowPath()
     // Pixel 4, 5
     //
     
-    drawCanvasPixel(4, mode, d016);
-    drawCanvasPixel(5, mode, d016);
+    drawCanvasPixel <flags> (4, mode, d016);
+    drawCanvasPixel <flags> (5, mode, d016);
     
     // In older VICIIs, the zero bits of D011 show up here.
     if (is656x) {
@@ -255,7 +422,7 @@ VICII::drawCanvasSlowPath()
     // Pixel 6
     //
     
-    drawCanvasPixel(6, mode, d016);
+    drawCanvasPixel <flags> (6, mode, d016);
     
     /* Before the last pixel is drawn, a change in D016 is fully detected.
      * If the multicolor bit is set, the mc flip flop resets immediately.
@@ -269,10 +436,10 @@ VICII::drawCanvasSlowPath()
     // Pixel 7
     //
     
-    drawCanvasPixel(7, mode, d016);
+    drawCanvasPixel <flags> (7, mode, d016);
 }
 
-void
+template <u16 flags> void
 VICII::drawCanvasPixel(u8 pixel, u8 mode, u8 d016)
 {
     /* "The heart of the sequencer is a 8 bit shift register that is shifted
@@ -307,8 +474,8 @@ VICII::drawCanvasPixel(u8 pixel, u8 mode, u8 d016)
     
     
     // Synthesize color
-    u8 color;
-    switch ((mode | mcBit) >> 1 | sr.colorbits) {
+    u8 color = 0;
+    if constexpr (!(flags & HEADLESS_CYCLE)) switch ((mode | mcBit) >> 1 | sr.colorbits) {
             
             // DISPLAY_MODE_STANDARD_TEXT
         case 0x00: case 0x04: color = reg.delayed.colors[COLREG_BG0]; break;
@@ -375,4 +542,25 @@ VICII::loadShiftRegister()
     }
 }
 
+template void VICII::drawBorder<0>();
+template void VICII::drawBorder17<0>();
+template void VICII::drawBorder55<0>();
+template void VICII::drawCanvas<0>();
+template void VICII::drawCanvasFastPath<0>();
+template void VICII::drawCanvasPixels<0>();
+
+template void VICII::drawBorder<HEADLESS_CYCLE>();
+template void VICII::drawBorder17<HEADLESS_CYCLE>();
+template void VICII::drawBorder55<HEADLESS_CYCLE>();
+template void VICII::drawCanvas<HEADLESS_CYCLE>();
+template void VICII::drawCanvasFastPath<HEADLESS_CYCLE>();
+template void VICII::drawCanvasPixels<HEADLESS_CYCLE>();
+
+template void VICII::drawBorder<INDEXED_CYCLE>();
+template void VICII::drawBorder17<INDEXED_CYCLE>();
+template void VICII::drawBorder55<INDEXED_CYCLE>();
+template void VICII::drawCanvas<INDEXED_CYCLE>();
+template void VICII::drawCanvasFastPath<INDEXED_CYCLE>();
+template void VICII::drawCanvasPixels<INDEXED_CYCLE>();
+
 }
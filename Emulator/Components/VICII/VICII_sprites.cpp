@@ -15,16 +15,16 @@
 
 namespace vc64 {
 
-void
+template <u16 flags> void
 VICII::drawSprites()
 {
     assert(!isFirstDMAcycle);
     assert(!isSecondDMAcycle);
     
     if ((delay & VICUpdateRegisters) || VIC_SAFE_MODE == 1) {
-        drawSpritesSlowPath();
+        drawSpritesSlowPath <flags> ();
     } else {
-        drawSpritesFastPath();
+        drawSpritesFastPath <flags> ();
     }
 }
 
@@ -32,7 +32,7 @@ VICII::drawSprites()
 // Fast path
 //
 
-void
+template <u16 flags> void
 VICII::drawSpritesFastPath()
 {    
     if (VIC_STATS) stats.spriteFastPath++;
@@ -40,33 +40,45 @@ VICII::drawSpritesFastPath()
     // Prepare for collision detection
     for (isize i = 0; i < 8; i++) collision[i] = 0;
     
+    /* Determine the sprites covering this cycle. These are all sprites with a
+     * running shift register and all enabled sprites whose shift register is
+     * started in one of the eight pixels.
+     */
+    u8 covering = spriteSrActive | (spriteDisplay & spriteTriggers());
+    
+    // Skip all sprite work if there is nothing to draw
+    if (!covering) return;
+    
+    // Pixels that have already been drawn by a sprite with higher priority
+    u8 occupied = 0;
+    
     // Iterate through all 8 sprites
     for (isize i = 0; i < 8; i++) {
 
+        if (!GET_BIT(covering, i)) continue;
+        
         bool enable = GET_BIT(spriteDisplay, i);
         bool active = GET_BIT(spriteSrActive, i);
         
-        // Skip this sprite if there is nothing to draw
-        if (!enable && !active) continue;
-
         if (GET_BIT(reg.delayed.sprMC, i)) {
             
             // Draw multicolor sprite
-            drawSpriteNr <true> (i, enable, active);
+            drawSpriteNr <flags, true> (i, enable, active, occupied);
             
         } else {
             
             // Draw monocolor sprite
-            drawSpriteNr <false> (i, enable, active);
+            drawSpriteNr <flags, false> (i, enable, active, occupied);
         }
+        occupied |= collision[i];
     }
 
     // Perform collision checks
     checkCollisions();
 }
 
-template <bool multicolor> void
-VICII::drawSpriteNr(isize nr, bool enable, bool active)
+template <u16 flags, bool multicolor> void
+VICII::drawSpriteNr(isize nr, bool enable, bool active, u8 occupied)
 {
     bool xExp = GET_BIT(reg.delayed.sprExpandX, nr);
 
@@ -122,7 +134,7 @@ VICII::drawSpriteNr(isize nr, bool enable, bool active)
             if (spriteSr[nr].colBits && !config.hideSprites) {
                 
                 // Only draw the pixel if no other sprite pixel has been drawn yet
-                if (!collision[pixel]) {
+                if (!GET_BIT(occupied, pixel)) {
                     
                     u8 color =
                     spriteSr[nr].colBits == 1 ? reg.delayed.colors[COLREG_SPR_EX1] :
@@ -131,7 +143,7 @@ VICII::drawSpriteNr(isize nr, bool enable, bool active)
                     
                     SET_SPRITE_PIXEL(nr, pixel, color);
                 }
-                collision[pixel] |= (1 << nr);
+                SET_BIT(collision[nr], pixel);
             }
         }
     }
@@ -141,7 +153,7 @@ VICII::drawSpriteNr(isize nr, bool enable, bool active)
 // Slow path
 //
 
-void
+template <u16 flags> void
 VICII::drawSpritesSlowPath()
 {
     if (VIC_STATS) stats.spriteSlowPath++;
@@ -156,7 +168,7 @@ VICII::drawSpritesSlowPath()
     // Pixel 0
     //
     
-    drawSpritePixel(0, spriteDisplayDelayed, secondDMA);
+    drawSpritePixel <flags> (0, spriteDisplayDelayed, secondDMA);
     
     // After the first pixel, color register changes show up
     reg.delayed.colors[COLREG_SPR_EX1] = reg.current.colors[COLREG_SPR_EX1];
@@ -169,13 +181,13 @@ VICII::drawSpritesSlowPath()
     // Pixel 1, 2, 3
     //
 
-    drawSpritePixel(1, spriteDisplayDelayed, secondDMA);
+    drawSpritePixel <flags> (1, spriteDisplayDelayed, secondDMA);
     
     // Stop shift register on the second DMA cycle
     spriteSrActive &= ~secondDMA;
     
-    drawSpritePixel(2, spriteDisplayDelayed, secondDMA);
-    drawSpritePixel(3, spriteDisplayDelayed, firstDMA | secondDMA);
+    drawSpritePixel <flags> (2, spriteDisplayDelayed, secondDMA);
+    drawSpritePixel <flags> (3, spriteDisplayDelayed, firstDMA | secondDMA);
     
     // If a shift register is loaded, the new data appears here
     updateSpriteShiftRegisters();
@@ -184,8 +196,8 @@ VICII::drawSpritesSlowPath()
     // Pixel 4, 5
     //
 
-    drawSpritePixel(4, spriteDisplay, firstDMA | secondDMA);
-    drawSpritePixel(5, spriteDisplay, firstDMA | secondDMA);
+    drawSpritePixel <flags> (4, spriteDisplay, firstDMA | secondDMA);
+    drawSpritePixel <flags> (5, spriteDisplay, firstDMA | secondDMA);
     
     // Changes of the X expansion bits and the priority bits show up here
     reg.delayed.sprExpandX = reg.current.sprExpandX;
@@ -212,7 +224,7 @@ VICII::drawSpritesSlowPath()
     // Pixel 6
     //
 
-    drawSpritePixel(6, spriteDisplay, firstDMA | secondDMA);
+    drawSpritePixel <flags> (6, spriteDisplay, firstDMA | secondDMA);
     
     // Update multicolor bits if an old VICII is emulated
     if (toggle && is656x) {
@@ -225,17 +237,20 @@ VICII::drawSpritesSlowPath()
     }
     
     // Pixel 7
-    drawSpritePixel(7, spriteDisplay, firstDMA);
+    drawSpritePixel <flags> (7, spriteDisplay, firstDMA);
     
     // Perform collision checks
     checkCollisions();
 }
 
-void
+template <u16 flags> void
 VICII::drawSpritePixel(isize pixel, u8 enableBits, u8 freezeBits)
 {
     if (!enableBits && !spriteSrActive) return;
     
+    // Indicates whether a sprite with higher priority has drawn this pixel
+    bool occupied = false;
+    
     // Iterate over all sprites
     for (isize sprite = 0; sprite < 8; sprite++) {
         
@@ -306,7 +321,7 @@ VICII::drawSpritePixel(isize pixel, u8 enableBits, u8 freezeBits)
             if (spriteSr[sprite].colBits && !config.hideSprites) {
                 
                 // Only draw the pixel if no other sprite pixel has been drawn yet
-                if (!collision[pixel]) {
+                if (!occupied) {
                     
                     u8 color =
                     spriteSr[sprite].colBits == 1 ? reg.delayed.colors[COLREG_SPR_EX1] :
@@ -315,39 +330,80 @@ VICII::drawSpritePixel(isize pixel, u8 enableBits, u8 freezeBits)
                     
                     SET_SPRITE_PIXEL(sprite, pixel, color);
                 }
-                collision[pixel] |= (1 << sprite);
+                occupied = true;
+                SET_BIT(collision[sprite], pixel);
             }
         }
     }
 }
 
+u8
+VICII::spriteTriggers() const
+{
+    u8 result = 0;
+    
+    // A shift register starts if the x counter hits the sprite's x coordinate
+    for (isize i = 0; i < 8; i++) {
+        if (u16(reg.delayed.sprX[i] - xCounter) < 8) SET_BIT(result, i);
+    }
+    return result;
+}
+
 void
 VICII::checkCollisions()
 {
+    // Determine all pixels covered by at least one and by multiple sprites
+    u8 covered = 0;
+    u8 overlap = 0;
+    
+    for (isize i = 0; i < 8; i++) {
+        
+        overlap |= covered & collision[i];
+        covered |= collision[i];
+    }
+    
     // Only proceed if there was any collision at all
+    if (!covered) return;
+    
+    // Collects all sprites covering at least one of the given pixels
+    auto sprites = [&](u8 pixels) {
+        
+        u8 result = 0;
+        for (isize i = 0; i < 8; i++) if (collision[i] & pixels) SET_BIT(result, i);
+        return result;
+    };
+    
+    // Check for sprite-sprite collisions (at least 2 sprites share a pixel)
+    if (overlap && config.checkSSCollisions) {
+        
+        // Trigger an IRQ if this is the first detected collision
+        if (!spriteSpriteCollision) triggerIrq(4);
+        
+        spriteSpriteCollision |= sprites(overlap);
+    }
+    
+    // Check for sprite-background collisions (z buffer bit 4 must be set)
+    u8 foreground = 0;
     for (isize i = 0; i < 8; i++) {
+        if (zBuffer[bufferoffset + i] & 0x10) SET_BIT(foreground, i);
+    }
+    
+    if ((covered & foreground) && config.checkSBCollisions) {
         
-        if (collision[i]) {
-            
-            // Check for sprite-sprite collisions (at least 2 bits must be set)
-            if ((collision[i] & (collision[i] - 1)) && config.checkSSCollisions) {
-                
-                // Trigger an IRQ if this is the first detected collision
-                if (!spriteSpriteCollision) triggerIrq(4);
-                
-                spriteSpriteCollision |= collision[i];
-            }
-            
-            // Check for sprite-background collisions (z buffer bit 4 must be set)
-            if ((zBuffer[bufferoffset + i] & 0x10) && config.checkSBCollisions) {
-                
-                // Trigger an IRQ if this is the first detected collision
-                if (!spriteBackgroundColllision) triggerIrq(2);
-                
-                spriteBackgroundColllision |= collision[i];
-            }
-        }
+        // Trigger an IRQ if this is the first detected collision
+        if (!spriteBackgroundColllision) triggerIrq(2);
+        
+        spriteBackgroundColllision |= sprites(foreground);
     }
 }
 
+template void VICII::drawSprites<0>();
+template void VICII::drawSpritesSlowPath<0>();
+
+template void VICII::drawSprites<HEADLESS_CYCLE>();
+template void VICII::drawSpritesSlowPath<HEADLESS_CYCLE>();
+
+template void VICII::drawSprites<INDEXED_CYCLE>();
+template void VICII::drawSpritesSlowPath<INDEXED_CYCLE>();
+
 }
@@ -18,7 +18,15 @@ namespace vc64 {
 void
 VICII::updateVicFunctionTable()
 {    
-    trace(VIC_DEBUG, "updateVicFunctionTable (dmaDebug: %d)\n", dmaDebug());
+    trace(VIC_DEBUG, "updateVicFunctionTable (dmaDebug: %d, headless: %d, indexed: %d)\n",
+          dmaDebug(), config.headless, config.indexed);
+
+    /* The DMA debugger and the layer cutter modify RGBA values. Hence, both
+     * take precedence over the indexed mode.
+     */
+    drawIndexed =
+    config.indexed && !config.headless && !dmaDebug() &&
+    !(dmaDebugger.config.cutLayers & 0x1000);
     
     vicfunc[0] = nullptr;
     vicfunc[64] = nullptr;
@@ -31,48 +39,19 @@ VICII::updateVicFunctionTable()
         case VICII_PAL_6569_R3:
         case VICII_PAL_8565:
             
-            if (dmaDebug()) {
-                for (isize i = 1; i <= 63; i++) {
-                    vicfunc[i] = getViciiFunc <PAL_CYCLE | DEBUG_CYCLE> (i);
-                }
-            } else {
-                for (isize i = 1; i <= 63; i++) {
-                    vicfunc[i] = getViciiFunc <PAL_CYCLE> (i);
-                }
-            }
+            assignViciiFuncs <PAL_CYCLE> (1, 63);
             break;
 
         case VICII_NTSC_6567_R56A:
             
-            if (dmaDebug()) {
-                for (isize i = 1; i <= 11; i++) {
-                    vicfunc[i] = getViciiFunc <PAL_CYCLE | DEBUG_CYCLE> (i);
-                }
-                for (isize i = 12; i <= 64; i++) {
-                    vicfunc[i] = getViciiFunc <NTSC_CYCLE | DEBUG_CYCLE> (i);
-                }
-            } else {
-                for (isize i = 1; i <= 11; i++) {
-                    vicfunc[i] = getViciiFunc <PAL_CYCLE> (i);
-                }
-                for (isize i = 12; i <= 64; i++) {
-                    vicfunc[i] = getViciiFunc <NTSC_CYCLE> (i);
-                }
-            }
+            assignViciiFuncs <PAL_CYCLE> (1, 11);
+            assignViciiFuncs <NTSC_CYCLE> (12, 64);
             break;
 
         case VICII_NTSC_6567:
         case VICII_NTSC_8562:
             
-            if (dmaDebug()) {
-                for (isize i = 1; i <= 65; i++) {
-                    vicfunc[i] = getViciiFunc <NTSC_CYCLE | DEBUG_CYCLE> (i);
-                }
-            } else {
-                for (isize i = 1; i <= 65; i++) {
-                    vicfunc[i] = getViciiFunc <NTSC_CYCLE> (i);
-                }
-            }
+            assignViciiFuncs <NTSC_CYCLE> (1, 65);
             break;
             
         default:
@@ -80,6 +59,31 @@ VICII::updateVicFunctionTable()
     }
 }
 
+template <u16 flags> void
+VICII::assignViciiFuncs(isize first, isize last)
+{
+    /* The DMA debugger needs the pixel pipeline to superimpose its overlay.
+     * Hence, it takes precedence over the headless mode.
+     */
+    if (dmaDebug()) {
+        for (isize i = first; i <= last; i++) {
+            vicfunc[i] = getViciiFunc <flags | DEBUG_CYCLE> (i);
+        }
+    } else if (isHeadless()) {
+        for (isize i = first; i <= last; i++) {
+            vicfunc[i] = getViciiFunc <flags | HEADLESS_CYCLE> (i);
+        }
+    } else if (drawIndexed) {
+        for (isize i = first; i <= last; i++) {
+            vicfunc[i] = getViciiFunc <flags | INDEXED_CYCLE> (i);
+        }
+    } else {
+        for (isize i = first; i <= last; i++) {
+            vicfunc[i] = getViciiFunc <flags> (i);
+        }
+    }
+}
+
 template <u16 flags> VICII::ViciiFunc
 VICII::getViciiFunc(isize cycle)
 {
@@ -15,6 +15,7 @@
 #include "Script.h"
 #include <filesystem>
 #include <chrono>
+#include <algorithm>
 
 #ifndef _WIN32
 #include <getopt.h>
@@ -28,11 +29,14 @@ int main(int argc, char *argv[])
 
     } catch (vc64::SyntaxError &e) {
 
-        std::cout << "Usage: VirtualC64Core [-svm] | { [-vm] <script> } " << std::endl;
+        std::cout << "Usage: VirtualC64Core [-svmpd] [-i <n>] | { [-vmp] [-i <n>] <script> } " << std::endl;
         std::cout << std::endl;
         std::cout << "       -s or --selftest  Checks the integrity of the build" << std::endl;
+        std::cout << "       -d or --drivetest Checks that all drive sync modes agree" << std::endl;
         std::cout << "       -v or --verbose   Print executed script lines" << std::endl;
         std::cout << "       -m or --messages  Observe the message queue" << std::endl;
+        std::cout << "       -p or --profile   Print profiling data in CSV format" << std::endl;
+        std::cout << "       -i or --instances Run the script in n instances on a thread pool" << std::endl;
         std::cout << std::endl;
 
         if (auto what = string(e.what()); !what.empty()) {
@@ -75,6 +79,16 @@ Headless::main(int argc, char *argv[])
     // Redirect shell output to the console in verbose mode
     if (keys.find("verbose") != keys.end()) c64.retroShell.setStream(std::cout);
 
+    // Compare the drive sync modes if requested
+    if (keys.find("drivetest") != keys.end()) {
+        return runDriveTest();
+    }
+
+    // Run multiple instances on a thread pool if requested
+    if (keys.find("instances") != keys.end()) {
+        return runInstances(isize(std::stoi(keys["instances"])));
+    }
+
     // Read the input script
     Script script(keys["arg1"]);
 
@@ -91,6 +105,15 @@ Headless::main(int argc, char *argv[])
         c64.retroShell.continueScript();
     }
 
+    // Print profiling data if requested
+    if (keys.find("profile") != keys.end()) {
+
+        if (!profileBuild) {
+            std::cerr << "Profiling data is only recorded if PROFILEBUILD is defined" << std::endl;
+        }
+        c64.profiler.csv(std::cout);
+    }
+
     return *returnCode;
 }
 
@@ -114,6 +137,9 @@ Headless::parseArguments(int argc, char *argv[])
         { "selftest",   no_argument,    NULL,   's' },
         { "verbose",    no_argument,    NULL,   'v' },
         { "messages",   no_argument,    NULL,   'm' },
+        { "profile",    no_argument,    NULL,   'p' },
+        { "instances",  required_argument, NULL, 'i' },
+        { "drivetest",  no_argument,    NULL,   'd' },
         { NULL,         0,              NULL,    0  }
     };
     
@@ -126,7 +152,7 @@ Headless::parseArguments(int argc, char *argv[])
     // Parse all options
     while (1) {
         
-        int arg = getopt_long(argc, argv, ":svm", long_options, NULL);
+        int arg = getopt_long(argc, argv, ":svmpi:d", long_options, NULL);
         if (arg == -1) break;
 
         switch (arg) {
@@ -143,6 +169,18 @@ Headless::parseArguments(int argc, char *argv[])
                 keys["messages"] = "1";
                 break;
 
+            case 'p':
+                keys["profile"] = "1";
+                break;
+
+            case 'i':
+                keys["instances"] = optarg;
+                break;
+
+            case 'd':
+                keys["drivetest"] = "1";
+                break;
+
             case ':':
                 throw SyntaxError("Missing argument for option '" +
                                   string(argv[optind - 1]) + "'");
@@ -171,11 +209,21 @@ Headless::parseArguments(int argc, char *argv[])
 void
 Headless::checkArguments()
 {
-    if (keys.find("selftest") != keys.end()) {
+    if (keys.find("instances") != keys.end()) {
+
+        // The number of instances must be a positive number
+        auto value = keys["instances"];
+        if (value.empty() || !std::all_of(value.begin(), value.end(), ::isdigit) ||
+            std::stoi(value) < 1 || std::stoi(value) > 256) {
+            throw SyntaxError("Invalid number of instances: " + value);
+        }
+    }
+
+    if (keys.find("selftest") != keys.end() || keys.find("drivetest") != keys.end()) {
 
         // No input file must be given
         if (keys.find("arg1") != keys.end()) {
-            throw SyntaxError("No script file must be given in selftest mode");
+            throw SyntaxError("No script file must be given in test mode");
         }
 
     } else {
@@ -207,6 +255,245 @@ Headless::selfTestScript()
     return path.string();
 }
 
+int
+Headless::runInstances(isize count)
+{
+    using namespace std::chrono;
+
+    struct Instance {
+
+        // The emulator
+        C64 c64;
+
+        // Return code of the script (set when the script has terminated)
+        std::optional<int> returnCode;
+
+        // Time at which a paused script continues
+        steady_clock::time_point resume;
+        bool paused = false;
+    };
+
+    bool messages = keys.find("messages") != keys.end();
+    bool verbose = keys.find("verbose") != keys.end();
+
+    // The pool must outlive the instances
+    ThreadPool pool;
+    std::vector<std::unique_ptr<Instance>> instances;
+
+    Script script(keys["arg1"]);
+
+    for (isize i = 0; i < count; i++) {
+
+        instances.push_back(std::make_unique<Instance>());
+        auto &c64 = instances.back()->c64;
+
+        if (verbose) c64.retroShell.setStream(std::cout);
+        c64.launch(pool);
+        script.execute(c64);
+    }
+
+    // Poll the message queues until all scripts have terminated
+    while (true) {
+
+        bool done = true;
+        bool idle = true;
+
+        for (isize i = 0; i < count; i++) {
+
+            auto &instance = *instances[i];
+            Message msg;
+
+            while (!instance.returnCode && instance.c64.msgQueue.get(msg)) {
+
+                idle = false;
+
+                if (messages) {
+
+                    std::cout << "[" << i << "] " << MsgTypeEnum::key(msg.type);
+                    std::cout << "(" << msg.value << ")" << std::endl;
+                }
+
+                switch (msg.type) {
+
+                    case MSG_SCRIPT_DONE:
+
+                        instance.returnCode = 0;
+                        break;
+
+                    case MSG_SCRIPT_ABORT:
+                    case MSG_ABORT:
+
+                        instance.returnCode = 1;
+                        break;
+
+                    case MSG_SCRIPT_PAUSE:
+
+                        instance.paused = true;
+                        instance.resume = steady_clock::now() + seconds(msg.script.delay);
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+
+            if (instance.paused && steady_clock::now() >= instance.resume) {
+
+                instance.paused = false;
+                instance.c64.retroShell.continueScript();
+                idle = false;
+            }
+
+            if (!instance.returnCode) done = false;
+        }
+
+        if (done) break;
+        if (idle) std::this_thread::sleep_for(milliseconds(10));
+    }
+
+    // Print profiling data if requested
+    if (keys.find("profile") != keys.end()) {
+
+        for (auto &instance : instances) instance->c64.profiler.csv(std::cout);
+    }
+
+    int result = 0;
+    for (auto &instance : instances) result = std::max(result, *instance->returnCode);
+    return result;
+}
+
+int
+Headless::runDriveTest()
+{
+    /* Drive program. It keeps the disk spinning, reads GCR bytes, mixes them
+     * with the IEC port and writes the result back to the bus. After every
+     * 256 bytes, it steps the read/write head.
+     */
+    static constexpr u8 driveCode[] = {
+
+        0x78,                   // C000: SEI
+        0xA2, 0xFF,             //       LDX #$FF
+        0x9A,                   //       TXS
+        0xD8,                   //       CLD
+        0xA9, 0x1A,             //       LDA #$1A
+        0x8D, 0x02, 0x18,       //       STA $1802   ; VIA1 DDRB
+        0xA9, 0x6F,             //       LDA #$6F
+        0x8D, 0x02, 0x1C,       //       STA $1C02   ; VIA2 DDRB
+        0xA9, 0xEE,             //       LDA #$EE
+        0x8D, 0x0C, 0x1C,       //       STA $1C0C   ; VIA2 PCR
+        0xA9, 0x00,             //       LDA #$00
+        0x8D, 0x03, 0x1C,       //       STA $1C03   ; VIA2 DDRA
+        0xA9, 0x6C,             //       LDA #$6C
+        0x8D, 0x00, 0x1C,       //       STA $1C00   ; Motor and LED on
+        0xB8,                   // C01E: CLV
+        0x50, 0xFE,             //       BVC *       ; Wait for byte ready
+        0xAD, 0x01, 0x1C,       //       LDA $1C01
+        0x45, 0x00,             //       EOR $00
+        0x85, 0x00,             //       STA $00
+        0xAD, 0x00, 0x18,       //       LDA $1800
+        0x65, 0x00,             //       ADC $00
+        0x85, 0x00,             //       STA $00
+        0x29, 0x0A,             //       AND #$0A
+        0x8D, 0x00, 0x18,       //       STA $1800   ; Drive DATA and CLK
+        0xE6, 0x01,             //       INC $01
+        0xD0, 0xE6,             //       BNE $C01E
+        0xAD, 0x00, 0x1C,       //       LDA $1C00
+        0x49, 0x01,             //       EOR #$01
+        0x8D, 0x00, 0x1C,       //       STA $1C00   ; Step the head
+        0x4C, 0x1E, 0xC0        //       JMP $C01E
+    };
+
+    /* C64 program. It mixes the IEC port into a running value and writes the
+     * result back to the bus after a data-dependent delay.
+     */
+    static constexpr u8 c64Code[] = {
+
+        0x78,                   // C000: SEI
+        0xA9, 0x3F,             //       LDA #$3F
+        0x8D, 0x02, 0xDD,       //       STA $DD02   ; CIA2 DDRA
+        0xAD, 0x00, 0xDD,       // C006: LDA $DD00
+        0x45, 0xFB,             //       EOR $FB
+        0x65, 0xFC,             //       ADC $FC
+        0x85, 0xFB,             //       STA $FB
+        0x29, 0x38,             //       AND #$38
+        0x09, 0x03,             //       ORA #$03
+        0x8D, 0x00, 0xDD,       //       STA $DD00   ; Drive ATN, CLK, DATA
+        0xE6, 0xFC,             //       INC $FC
+        0xA5, 0xFB,             //       LDA $FB
+        0x29, 0x0F,             //       AND #$0F
+        0xA8,                   //       TAY
+        0xC8,                   //       INY
+        0x88,                   // C01E: DEY
+        0xD0, 0xFD,             //       BNE $C01E
+        0x4C, 0x06, 0xC0        //       JMP $C006
+    };
+
+    static constexpr isize frames = 200;
+
+    // Setup a drive ROM that jumps to the drive program after a reset
+    std::vector<u8> rom(0x4000, 0xEA);
+    std::copy(std::begin(driveCode), std::end(driveCode), rom.begin());
+    rom[0x2AA0] = 0x4C; rom[0x2AA1] = 0x00; rom[0x2AA2] = 0xC0;
+
+    int result = 0;
+
+    for (isize drives = 1; drives <= 2; drives++) {
+
+        std::vector<u64> checksums[3];
+
+        for (isize mode = 0; mode < 3; mode++) {
+
+            auto c64 = std::make_unique<C64>();
+            c64->launch();
+            c64->configure(OPT_DRIVE_SYNC, mode);
+            c64->configure(OPT_VIC_HEADLESS, true);
+
+            for (isize i = 0; i < drives; i++) {
+
+                auto &drive = i ? c64->drive9 : c64->drive8;
+                drive.mem.loadRom(rom.data(), isize(rom.size()));
+                c64->configure(OPT_DRV_CONNECT, drive.getDeviceNr(), true);
+                c64->configure(OPT_DRV_POWER_SAVE, drive.getDeviceNr(), false);
+                drive.insertNewDisk(DOS_TYPE_CBM, PETName<16>("TEST"));
+            }
+
+            c64->powerOn();
+            for (isize i = 0; i < isizeof(c64Code); i++) {
+                c64->mem.poke(u16(0xC000 + i), c64Code[i]);
+            }
+            c64->cpu.debugger.jump(0xC000);
+
+            // Compare the checksums at the end of each frame
+            for (isize i = 0; i < frames; i++) {
+
+                for (auto frame = c64->frame; frame == c64->frame;) c64->execute();
+                c64->syncDrives(c64->cpu.clock);
+                checksums[mode].push_back(c64->checksum());
+
+                Message msg;
+                while (c64->msgQueue.get(msg)) { }
+            }
+        }
+
+        for (isize mode = 1; mode < 3; mode++) {
+
+            auto it = std::mismatch(checksums[0].begin(), checksums[0].end(),
+                                    checksums[mode].begin());
+            std::cout << DriveSyncEnum::key(DriveSync(mode));
+            std::cout << " with " << drives << " drive(s): ";
+
+            if (it.first == checksums[0].end()) {
+                std::cout << "Identical to LOCKSTEP" << std::endl;
+            } else {
+                std::cout << "Diverges in frame " << (it.first - checksums[0].begin()) << std::endl;
+                result = 1;
+            }
+        }
+    }
+
+    return result;
+}
+
 void
 process(const void *listener, Message msg)
 {
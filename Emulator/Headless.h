@@ -61,6 +61,12 @@ private:
     // Returns the path to the self-test script
     string selfTestScript();
 
+    // Runs the script in multiple instances sharing a thread pool
+    int runInstances(isize count);
+
+    // Checks that all drive sync modes produce identical results
+    int runDriveTest();
+
 
     //
     // Running
@@ -107,6 +113,11 @@ static const char *testScript[] = {
     "c64 defaults",
     "c64 set fps 50",
     "c64 set fps 60",
+    "c64 set drivesync LOCKSTEP",
+    "c64 set drivesync THREADED",
+    "c64 set drivesync CATCHUP",
+    "c64 set runahead 2",
+    "c64 set runahead 0",
     "c64 init PAL",
     "c64 init PAL_II",
     "c64 init PAL_OLD",
@@ -115,6 +126,22 @@ static const char *testScript[] = {
     "c64 init NTSC_OLD",
     "c64 reset",
 
+    "",
+    "rewinder",
+    "rewinder set history 60",
+    "rewinder set rate 10",
+    "rewinder set memory 64",
+    "rewinder clear",
+    "rewinder set history 0",
+
+    "",
+    "movie",
+    "movie record",
+    "movie stop",
+    "movie events",
+    "movie replay",
+    "movie stop",
+
     "",
     "memory",
     "memory set raminit VICE",
@@ -151,6 +178,10 @@ static const char *testScript[] = {
     "vicii set graydotbug false",
     "vicii set gluelogic true",
     "vicii set gluelogic false",
+    "vicii set headless true",
+    "vicii set headless false",
+    "vicii set indexed true",
+    "vicii set indexed false",
     "vicii set sscollisions true",
     "vicii set sscollisions false",
     "vicii set sbcollisions true",
@@ -193,6 +224,8 @@ static const char *testScript[] = {
     "sid set sampling RESAMPLE_FASTMEM",
     "sid set filter true",
     "sid set filter false",
+    "sid set parallel false",
+    "sid set parallel true",
     "sid set volume channel0 50",
     "sid set volume channel1 50",
     "sid set volume channel2 50",
@@ -14,6 +14,9 @@
 #include "Snapshot.h"
 #include "C64.h"
 #include "IOUtils.h"
+#include "Compression.h"
+#include "Serialization.h"
+#include <unordered_map>
 
 namespace vc64 {
 
@@ -29,7 +32,7 @@ Thumbnail::makeWithC64(const C64 &c64, isize dx, isize dy)
 void
 Thumbnail::take(const C64 &c64, isize dx, isize dy)
 {
-    u32 *source = (u32 *)c64.vic.stableEmuTexture();
+    u32 *source = (u32 *)c64.vic.latestEmuTexture();
     u32 *target = screen;
 
     isize xStart = FIRST_VISIBLE_PIXEL;
@@ -60,7 +63,9 @@ Snapshot::isCompatible(const string &path)
 bool
 Snapshot::isCompatible(std::istream &stream)
 {
-    return util::matchingStreamHeader(stream, "VC64");
+    return
+    util::matchingStreamHeader(stream, "VC64") ||
+    util::matchingStreamHeader(stream, "VC6Z");
 }
 
 Snapshot::Snapshot(isize capacity)
@@ -97,6 +102,8 @@ Snapshot::finalizeRead()
     if (isTooOld()) throw VC64Error(ERROR_SNAP_TOO_OLD);
     if (isTooNew()) throw VC64Error(ERROR_SNAP_TOO_NEW);
     if (isBeta() && !betaRelease) throw VC64Error(ERROR_SNAP_IS_BETA);
+
+    if (isCompressed()) uncompress();
 }
 
 bool
@@ -141,7 +148,7 @@ Snapshot::takeScreenshot(C64 &c64)
     header->screenshot.width = VISIBLE_PIXELS;
     header->screenshot.height = c64.vic.numVisibleLines();
     
-    u32 *source = (u32 *)c64.vic.stableEmuTexture();
+    u32 *source = (u32 *)c64.vic.latestEmuTexture();
     u32 *target = header->screenshot.screen;
 
     isize xStart = FIRST_VISIBLE_PIXEL;
@@ -156,4 +163,152 @@ Snapshot::takeScreenshot(C64 &c64)
     }
 }
 
+bool
+Snapshot::isCompressed() const
+{
+    return size >= 4 && getHeader()->magic[3] == 'Z';
+}
+
+void
+Snapshot::compress()
+{
+    using namespace util;
+
+    if (isCompressed()) return;
+
+    auto header = getHeader();
+    auto &thumbnail = header->screenshot;
+    auto pixels = thumbnail.width * thumbnail.height;
+    auto stateSize = size - isize(sizeof(SnapshotHeader));
+
+    // Reduce the thumbnail to a color palette and an index table
+    std::vector<u32> palette;
+    std::unordered_map<u32, u8> colors;
+
+    for (isize i = 0; i < pixels && palette.size() <= 256; i++) {
+
+        auto color = thumbnail.screen[i];
+        if (colors.contains(color)) continue;
+
+        colors[color] = u8(palette.size());
+        palette.push_back(color);
+    }
+    bool indexed = palette.size() <= 256;
+    if (!indexed) palette.clear();
+
+    // Assemble the payload (palette, thumbnail, and core data)
+    isize payloadSize =
+    2 + 4 * isize(palette.size()) + pixels * (indexed ? 1 : 4) + stateSize;
+    std::vector<u8> payload(payloadSize);
+    u8 *ptr = payload.data();
+
+    write16(ptr, u16(palette.size()));
+    for (auto color : palette) write32(ptr, color);
+    for (isize i = 0; i < pixels; i++) {
+
+        auto color = thumbnail.screen[i];
+        if (indexed) { write8(ptr, colors[color]); } else { write32(ptr, color); }
+    }
+    std::memcpy(ptr, getData(), stateSize);
+
+    // Compress the payload
+    std::vector<u8> packed;
+    util::compress(payload.data(), payloadSize, packed);
+
+    // Write the compressed header and the compressed payload
+    isize newSize = 8 + 2 + 2 + 8 + 8 + 8 + isize(packed.size());
+    u8 *buffer = new u8[newSize];
+    ptr = buffer;
+
+    write8(ptr, 'V');
+    write8(ptr, 'C');
+    write8(ptr, '6');
+    write8(ptr, 'Z');
+    write8(ptr, header->major);
+    write8(ptr, header->minor);
+    write8(ptr, header->subminor);
+    write8(ptr, header->beta);
+    write16(ptr, u16(thumbnail.width));
+    write16(ptr, u16(thumbnail.height));
+    write64(ptr, u64(thumbnail.timestamp));
+    write64(ptr, u64(payloadSize));
+    write64(ptr, u64(stateSize));
+    std::memcpy(ptr, packed.data(), packed.size());
+
+    delete [] data;
+    data = buffer;
+    size = newSize;
+}
+
+void
+Snapshot::uncompress()
+{
+    using namespace util;
+
+    if (!isCompressed()) return;
+
+    // Read the compressed header
+    constexpr isize headerSize = 8 + 2 + 2 + 8 + 8 + 8;
+    if (size < headerSize) throw VC64Error(ERROR_SNAP_CORRUPTED);
+
+    const u8 *ptr = data + 8;
+    isize width = read16(ptr);
+    isize height = read16(ptr);
+    auto timestamp = time_t(read64(ptr));
+    auto payloadSize = isize(read64(ptr));
+    auto stateSize = isize(read64(ptr));
+    auto pixels = width * height;
+
+    if (pixels > TEX_HEIGHT * TEX_WIDTH ||
+        payloadSize < 2 || payloadSize > Allocator<u8>::maxCapacity ||
+        stateSize < 0 || stateSize > payloadSize) {
+        throw VC64Error(ERROR_SNAP_CORRUPTED);
+    }
+
+    // Uncompress the payload
+    std::vector<u8> payload(payloadSize);
+    if (!util::uncompress(ptr, size - headerSize, payload.data(), payloadSize)) {
+        throw VC64Error(ERROR_SNAP_CORRUPTED);
+    }
+
+    // Read the palette
+    ptr = payload.data();
+    isize numColors = read16(ptr);
+    bool indexed = numColors > 0;
+    if (payloadSize != 2 + 4 * numColors + pixels * (indexed ? 1 : 4) + stateSize) {
+        throw VC64Error(ERROR_SNAP_CORRUPTED);
+    }
+    std::vector<u32> palette(numColors);
+    for (auto &color : palette) color = read32(ptr);
+
+    // Create the uncompressed snapshot
+    isize newSize = isize(sizeof(SnapshotHeader)) + stateSize;
+    u8 *buffer = new u8[newSize]();
+    auto header = (SnapshotHeader *)buffer;
+
+    std::memcpy(header->magic, "VC64", 4);
+    header->major = getHeader()->major;
+    header->minor = getHeader()->minor;
+    header->subminor = getHeader()->subminor;
+    header->beta = getHeader()->beta;
+
+    header->screenshot.width = width;
+    header->screenshot.height = height;
+    header->screenshot.timestamp = timestamp;
+
+    for (isize i = 0; i < pixels; i++) {
+
+        if (!indexed) { header->screenshot.screen[i] = read32(ptr); continue; }
+
+        auto index = read8(ptr);
+        if (index >= numColors) { delete [] buffer; throw VC64Error(ERROR_SNAP_CORRUPTED); }
+        header->screenshot.screen[i] = palette[index];
+    }
+    std::memcpy(buffer + sizeof(SnapshotHeader), ptr, stateSize);
+
+    delete [] data;
+    data = buffer;
+    size = newSize;
+}
+
 }
@@ -39,7 +39,7 @@ struct Thumbnail {
 
 struct SnapshotHeader {
     
-    // Magic bytes ('V','C','6','4')
+    // Magic bytes ('V','C','6','4' or 'V','C','6','Z' if compressed)
     char magic[4];
     
     // Version number (V major.minor.subminor)
@@ -112,6 +112,25 @@ public:
 
     // Records a screenshot
     void takeScreenshot(C64 &c64);
+
+
+    //
+    // Compressing
+    //
+
+    /* In the compressed format, the thumbnail is stored as a color palette
+     * plus an index table. Both are compressed together with the core data.
+     * Compressed snapshots are uncompressed transparently when read from a
+     * file or buffer. Only the header fields preceding the thumbnail can be
+     * accessed in the compressed format.
+     */
+
+    // Checks whether the snapshot is stored in the compressed format
+    bool isCompressed() const;
+
+    // Converts the snapshot to the compressed or uncompressed format
+    void compress();
+    void uncompress() throws;
 };
 
 }
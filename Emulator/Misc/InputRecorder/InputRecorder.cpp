@@ -0,0 +1,458 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "InputRecorder.h"
+#include "C64.h"
+#include "IOUtils.h"
+#include <fstream>
+
+namespace vc64 {
+
+// Magic bytes identifying a movie file
+static constexpr u8 movieMagic[8] = { 'V', 'C', '6', '4', 'M', 'O', 'V', 0 };
+
+// Size of the movie file header (magic bytes, version, checksum)
+static constexpr isize movieHeaderSize = 8 + 4 + 8;
+
+void
+InputRecorder::_dump(Category category, std::ostream& os) const
+{
+    using namespace util;
+
+    if (category == Category::State) {
+
+        auto info = getInfo();
+
+        os << tab("State");
+        os << MovieStateEnum::key(info.state) << std::endl;
+        os << tab("Input events");
+        os << dec(info.events) << std::endl;
+        os << tab("Replayed events");
+        os << dec(info.replayed) << std::endl;
+        os << tab("First cycle");
+        os << dec(info.begin) << std::endl;
+        os << tab("Last cycle");
+        os << dec(info.end) << std::endl;
+    }
+
+    if (category == Category::Events) {
+
+        SYNCHRONIZED
+
+        for (auto &event : events) {
+
+            os << tab("Cycle " + std::to_string(event.cycle));
+            os << InputTypeEnum::key(event.type) << " " << dec(event.nr);
+            os << " " << dec(event.value) << std::endl;
+        }
+    }
+}
+
+InputRecorderInfo
+InputRecorder::getInfo() const
+{
+    SYNCHRONIZED
+
+    InputRecorderInfo result = { };
+
+    result.state = state;
+    result.events = isize(events.size());
+    result.replayed = cursor;
+    result.begin = begin;
+    result.end = isRecording() ? cpu.clock : end;
+
+    return result;
+}
+
+void
+InputRecorder::record()
+{
+    {   SUSPENDED
+
+        finish();
+
+        /* Pending auto-typing actions are not part of the emulator state.
+         * They would be processed while recording, but not while replaying.
+         */
+        keyboard.abortAutoTyping();
+
+        SYNCHRONIZED
+
+        // Save the initial state
+        initialState.alloc(c64.size());
+        c64.save(initialState.ptr);
+
+        events.clear();
+        pending.clear();
+        begin = end = cpu.clock;
+        cursor = 0;
+
+        // Start polling for input
+        state = MOVIE_RECORDING;
+        c64.scheduleImm<SLOT_INP>(INP_RECORD);
+    }
+
+    msgQueue.put(MSG_MOVIE_RECORD, 1);
+}
+
+bool
+InputRecorder::replay()
+{
+    {   SUSPENDED
+
+        stop();
+
+        if (initialState.empty()) return false;
+
+        // Restore the initial state
+        keyboard.abortAutoTyping();
+        c64.load(initialState.ptr);
+
+        // Feed in the recorded events as fast as possible
+        state = MOVIE_REPLAYING;
+        cursor = 0;
+        c64.warpOn(warpSource);
+        scheduleNextEvent();
+    }
+
+    msgQueue.put(MSG_MOVIE_REPLAY, 1);
+    return true;
+}
+
+void
+InputRecorder::stop()
+{
+    {   SUSPENDED
+
+        if (isRecording()) {
+
+            // Process all events that have not been polled yet
+            std::vector<InputEvent> queue;
+            {   SYNCHRONIZED
+
+                std::swap(queue, pending);
+                state = MOVIE_IDLE;
+            }
+
+            for (auto &event : queue) {
+
+                event.cycle = cpu.clock;
+                process(event);
+                events.push_back(std::move(event));
+            }
+            state = MOVIE_RECORDING;
+        }
+
+        finish();
+    }
+}
+
+void
+InputRecorder::finish()
+{
+    auto oldState = state;
+
+    {   SYNCHRONIZED
+
+        state = MOVIE_IDLE;
+        pending.clear();
+    }
+
+    c64.cancel<SLOT_INP>();
+
+    switch (oldState) {
+
+        case MOVIE_RECORDING:
+
+            end = cpu.clock;
+            msgQueue.put(MSG_MOVIE_RECORD, 0);
+            break;
+
+        case MOVIE_REPLAYING:
+
+            c64.switchWarp(false, u8(warpSource));
+            msgQueue.put(MSG_MOVIE_REPLAY, 0);
+            break;
+
+        default:
+            break;
+    }
+}
+
+void
+InputRecorder::save(const string &path)
+{
+    // Finish the recording first
+    if (isRecording()) stop();
+
+    SYNCHRONIZED
+
+    // Determine the size of the payload
+    util::SerCounter counter;
+    counter << begin << end << initialState << events;
+
+    // Write the payload
+    util::Buffer<u8> buffer(movieHeaderSize + counter.count);
+    util::SerWriter writer(buffer.ptr + movieHeaderSize);
+    writer << begin << end << initialState << events;
+
+    // Write the header
+    u8 *ptr = buffer.ptr;
+    std::memcpy(ptr, movieMagic, sizeof(movieMagic));
+    ptr += sizeof(movieMagic);
+    util::write8(ptr, SNP_MAJOR);
+    util::write8(ptr, SNP_MINOR);
+    util::write8(ptr, SNP_SUBMINOR);
+    util::write8(ptr, SNP_BETA);
+    util::write64(ptr, util::fnv64(buffer.ptr + movieHeaderSize, counter.count));
+
+    std::ofstream stream(path, std::ofstream::binary);
+    if (!stream.is_open()) throw VC64Error(ERROR_FILE_CANT_CREATE, path);
+
+    stream.write((const char *)buffer.ptr, buffer.size);
+    if (!stream) throw VC64Error(ERROR_FILE_CANT_WRITE, path);
+}
+
+void
+InputRecorder::load(const string &path)
+{
+    if (!util::fileExists(path)) throw VC64Error(ERROR_FILE_NOT_FOUND, path);
+
+    util::Buffer<u8> buffer(path);
+
+    // Check the header
+    if (buffer.size < movieHeaderSize || std::memcmp(buffer.ptr, movieMagic, 8)) {
+        throw VC64Error(ERROR_FILE_TYPE_MISMATCH, path);
+    }
+
+    const u8 *ptr = buffer.ptr + sizeof(movieMagic);
+    auto version = std::vector<isize> { util::read8(ptr), util::read8(ptr), util::read8(ptr) };
+    auto current = std::vector<isize> { SNP_MAJOR, SNP_MINOR, SNP_SUBMINOR };
+    util::read8(ptr);
+
+    if (version < current) throw VC64Error(ERROR_SNAP_TOO_OLD);
+    if (version > current) throw VC64Error(ERROR_SNAP_TOO_NEW);
+
+    // Check the payload
+    auto hash = util::read64(ptr);
+    if (hash != util::fnv64(ptr, buffer.size - movieHeaderSize)) {
+        throw VC64Error(ERROR_SNAP_CORRUPTED);
+    }
+
+    stop();
+
+    {   SYNCHRONIZED
+
+        util::SerReader reader(ptr);
+        reader << begin << end << initialState << events;
+        cursor = 0;
+    }
+}
+
+bool
+InputRecorder::intercepts() const
+{
+    return isRecording() && !c64.isEmulatorThread();
+}
+
+bool
+InputRecorder::capture(InputType type, isize nr, i64 value)
+{
+    if (!intercepts()) return false;
+
+    InputEvent event;
+    event.type = type;
+    event.nr = nr;
+    event.value = value;
+
+    return defer(std::move(event));
+}
+
+bool
+InputRecorder::capture(InputType type, isize nr, double x, double y)
+{
+    if (!intercepts()) return false;
+
+    InputEvent event;
+    event.type = type;
+    event.nr = nr;
+    event.x = x;
+    event.y = y;
+
+    return defer(std::move(event));
+}
+
+bool
+InputRecorder::capture(InputType type, const std::vector<C64Key> &keys, double delay)
+{
+    if (!intercepts()) return false;
+
+    InputEvent event;
+    event.type = type;
+    event.x = delay;
+    for (auto &key : keys) event.data.push_back(u8(key.nr));
+
+    return defer(std::move(event));
+}
+
+bool
+InputRecorder::capture(isize nr, Disk &disk)
+{
+    if (!intercepts()) return false;
+
+    InputEvent event;
+    event.type = INPUT_DISK_INSERT;
+    event.nr = nr;
+
+    // Store the disk in serialized form
+    util::SerCounter counter;
+    disk.serialize(counter);
+    event.data.resize(counter.count);
+    util::SerWriter writer(event.data.data());
+    disk.serialize(writer);
+
+    return defer(std::move(event));
+}
+
+bool
+InputRecorder::defer(InputEvent &&event)
+{
+    SYNCHRONIZED
+
+    // The recording might have been stopped in the meantime
+    if (!isRecording()) return false;
+
+    pending.push_back(std::move(event));
+    return true;
+}
+
+void
+InputRecorder::serviceEvent(EventID id)
+{
+    // Input is not processed in run-ahead frames
+    if (c64.isRunningAhead()) {
+
+        c64.cancel<SLOT_INP>();
+        return;
+    }
+
+    switch (id) {
+
+        case INP_RECORD:
+        {
+            std::vector<InputEvent> queue;
+            {   SYNCHRONIZED
+
+                std::swap(queue, pending);
+            }
+
+            for (auto &event : queue) {
+
+                event.cycle = cpu.clock;
+                process(event);
+
+                SYNCHRONIZED
+                events.push_back(std::move(event));
+            }
+
+            // Poll again at the end of the next scanline
+            c64.rescheduleRel<SLOT_INP>(vic.getCyclesPerLine());
+            break;
+        }
+        case INP_REPLAY:
+
+            while (cursor < isize(events.size()) && events[cursor].cycle <= cpu.clock) {
+                process(events[cursor++]);
+            }
+            scheduleNextEvent();
+            break;
+
+        default:
+            fatalError;
+    }
+}
+
+void
+InputRecorder::scheduleNextEvent()
+{
+    if (cursor < isize(events.size())) {
+
+        c64.scheduleAbs<SLOT_INP>(events[cursor].cycle, INP_REPLAY);
+
+    } else if (cpu.clock < end) {
+
+        c64.scheduleAbs<SLOT_INP>(end, INP_REPLAY);
+
+    } else {
+
+        // Pause the emulator in the cycle where the recording has ended
+        finish();
+        if (c64.isEmulatorThread()) c64.signalStop();
+    }
+}
+
+void
+InputRecorder::process(const InputEvent &event)
+{
+    debug(INP_DEBUG, "%lld: %s %ld %lld\n",
+          event.cycle, InputTypeEnum::key(event.type), event.nr, event.value);
+
+    auto &port = event.nr == PORT_1 ? port1 : port2;
+
+    std::vector<C64Key> keys;
+    for (auto &nr : event.data) keys.push_back(C64Key(nr));
+
+    switch (event.type) {
+
+        case INPUT_KEY_PRESS:           keyboard.press(C64Key(event.nr)); break;
+        case INPUT_KEY_RELEASE:         keyboard.release(C64Key(event.nr)); break;
+        case INPUT_KEY_RELEASE_ALL:     keyboard.releaseAll(); break;
+
+        case INPUT_SHIFT_LOCK:
+
+            event.value ? keyboard.pressShiftLock() : keyboard.releaseShiftLock();
+            break;
+
+        case INPUT_RESTORE:
+
+            event.value ? keyboard.pressRestore() : keyboard.releaseRestore();
+            break;
+
+        case INPUT_TYPE_PRESS:          keyboard.scheduleKeyPress(keys, event.x); break;
+        case INPUT_TYPE_RELEASE:        keyboard.scheduleKeyRelease(keys, event.x); break;
+        case INPUT_TYPE_RELEASE_ALL:    keyboard.scheduleKeyReleaseAll(event.x); break;
+        case INPUT_TYPE_ABORT:          keyboard.abortAutoTyping(); break;
+
+        case INPUT_JOYSTICK:            port.joystick.trigger(GamePadAction(event.value)); break;
+        case INPUT_MOUSE_XY:            port.mouse.setXY(event.x, event.y); break;
+        case INPUT_MOUSE_DXDY:          port.mouse.setDxDy(event.x, event.y); break;
+        case INPUT_MOUSE_LEFT:          port.mouse.setLeftButton(event.value); break;
+        case INPUT_MOUSE_RIGHT:         port.mouse.setRightButton(event.value); break;
+
+        case INPUT_DISK_INSERT:
+        {
+            util::SerReader reader(event.data.data());
+            drive[event.nr]->scheduleInsertion(std::make_unique<Disk>(reader));
+            break;
+        }
+        case INPUT_DISK_EJECT:
+
+            drive[event.nr]->scheduleEjection();
+            break;
+
+        default:
+            fatalError;
+    }
+}
+
+}
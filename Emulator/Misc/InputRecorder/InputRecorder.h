@@ -0,0 +1,206 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "InputRecorderTypes.h"
+#include "C64Types.h"
+#include "SubComponent.h"
+#include "C64Key.h"
+#include "JoystickTypes.h"
+
+namespace vc64 {
+
+class Disk;
+
+struct InputEvent : util::Serializable {
+
+    // Cycle in which the event has been processed
+    Cycle cycle = 0;
+
+    // Event type
+    InputType type = 0;
+
+    // Control port, drive, or key number
+    isize nr = 0;
+
+    // Event argument (button state, gamepad action)
+    i64 value = 0;
+
+    // Mouse coordinates or auto-typing delay
+    double x = 0.0;
+    double y = 0.0;
+
+    // Key list (auto typing) or disk contents (disk insertion)
+    std::vector<u8> data;
+
+    template <class W>
+    void operator<<(W& worker)
+    {
+        worker << cycle << type << nr << value << x << y << data;
+    }
+};
+
+/* The input recorder creates deterministic input movies. A movie consists of
+ * the emulator state at the beginning of the recording and all external input
+ * events, each stamped with the CPU cycle in which it was processed.
+ *
+ * While a movie is recorded, all input that originates outside the emulator
+ * thread (keyboard, control ports, disk changes) is intercepted and queued.
+ * The recorder polls the queue once per scanline in its own event slot and
+ * processes the pending events at a well-defined cycle. When a movie is
+ * replayed, the recorder restores the initial state and feeds the events back
+ * through the same event slot in the same cycles. Because no host timing is
+ * involved, movies are replayed in warp mode. Input events that originate in
+ * the emulator thread (e.g., auto-typing) are reproduced by the emulator
+ * itself and are never recorded. RetroShell commands are not recorded either.
+ * Only the input they generate is part of the movie. Other changes, such as
+ * configuration changes or memory writes, are lost, and the shell warns about
+ * this. Resetting the emulator, restoring a snapshot, or rewinding ends the
+ * recording or replay.
+ */
+class InputRecorder : public SubComponent {
+
+    // Warp source used during replay
+    static constexpr isize warpSource = 2;
+
+    // Current state
+    MovieState state = MOVIE_IDLE;
+
+    // Emulator state at the beginning of the movie
+    util::Buffer<u8> initialState;
+
+    // Recorded input events
+    std::vector<InputEvent> events;
+
+    // Input events waiting to be recorded
+    std::vector<InputEvent> pending;
+
+    // First and last cycle of the movie
+    Cycle begin = 0;
+    Cycle end = 0;
+
+    // Index of the next event to replay
+    isize cursor = 0;
+
+
+    //
+    // Constructing
+    //
+
+public:
+
+    using SubComponent::SubComponent;
+
+
+    //
+    // Methods from CoreObject
+    //
+
+private:
+
+    const char *getDescription() const override { return "InputRecorder"; }
+    void _dump(Category category, std::ostream& os) const override;
+
+
+    //
+    // Methods from CoreComponent
+    //
+
+private:
+
+    void _reset(bool hard) override { finish(); }
+    isize _size() override { return 0; }
+    u64 _checksum() override { return 0; }
+    isize _load(const u8 *buffer) override { return 0; }
+    isize _save(u8 *buffer) override { return 0; }
+
+
+    //
+    // Analyzing
+    //
+
+public:
+
+    InputRecorderInfo getInfo() const;
+
+    bool isRecording() const { return state == MOVIE_RECORDING; }
+    bool isReplaying() const { return state == MOVIE_REPLAYING; }
+
+
+    //
+    // Recording and replaying movies
+    //
+
+public:
+
+    // Starts recording a new movie
+    void record();
+
+    // Starts replaying the current movie (returns false if there is none)
+    bool replay() throws;
+
+    // Stops recording or replaying
+    void stop();
+
+    // Saves the current movie to a file or loads a movie from a file
+    void save(const string &path) throws;
+    void load(const string &path) throws;
+
+
+    //
+    // Intercepting input
+    //
+
+public:
+
+    /* Checks whether an input event needs to be deferred. If a movie is being
+     * recorded and the function is called outside the emulator thread, the
+     * event is queued and true is returned. The caller must not process the
+     * event in this case. Otherwise, false is returned.
+     */
+    bool capture(InputType type, isize nr = 0, i64 value = 0);
+    bool capture(InputType type, isize nr, double x, double y);
+    bool capture(InputType type, const std::vector<C64Key> &keys, double delay);
+    bool capture(isize nr, Disk &disk);
+
+private:
+
+    // Checks if input needs to be intercepted
+    bool intercepts() const;
+
+    // Queues an input event
+    bool defer(InputEvent &&event);
+
+
+    //
+    // Processing events
+    //
+
+public:
+
+    // Services an event in the input slot
+    void serviceEvent(EventID id);
+
+private:
+
+    // Processes a single input event
+    void process(const InputEvent &event);
+
+    // Schedules the next replay event or finishes the replay
+    void scheduleNextEvent();
+
+    // Returns to idle state
+    void finish();
+};
+
+}
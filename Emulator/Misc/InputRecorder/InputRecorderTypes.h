@@ -0,0 +1,126 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Aliases.h"
+#include "Reflection.h"
+
+//
+// Enumerations
+//
+
+enum_long(MOVIE_STATE)
+{
+    MOVIE_IDLE,
+    MOVIE_RECORDING,
+    MOVIE_REPLAYING
+};
+typedef MOVIE_STATE MovieState;
+
+#ifdef __cplusplus
+struct MovieStateEnum : util::Reflection<MovieStateEnum, MovieState>
+{
+    static constexpr long minVal = 0;
+    static constexpr long maxVal = MOVIE_REPLAYING;
+    static bool isValid(auto val) { return val >= minVal && val <= maxVal; }
+
+    static const char *prefix() { return "MOVIE"; }
+    static const char *key(MovieState value)
+    {
+        switch (value) {
+
+            case MOVIE_IDLE:        return "IDLE";
+            case MOVIE_RECORDING:   return "RECORDING";
+            case MOVIE_REPLAYING:   return "REPLAYING";
+        }
+        return "???";
+    }
+};
+#endif
+
+enum_long(INPUT_TYPE)
+{
+    INPUT_KEY_PRESS,
+    INPUT_KEY_RELEASE,
+    INPUT_KEY_RELEASE_ALL,
+    INPUT_SHIFT_LOCK,
+    INPUT_RESTORE,
+    INPUT_TYPE_PRESS,
+    INPUT_TYPE_RELEASE,
+    INPUT_TYPE_RELEASE_ALL,
+    INPUT_TYPE_ABORT,
+    INPUT_JOYSTICK,
+    INPUT_MOUSE_XY,
+    INPUT_MOUSE_DXDY,
+    INPUT_MOUSE_LEFT,
+    INPUT_MOUSE_RIGHT,
+    INPUT_DISK_INSERT,
+    INPUT_DISK_EJECT
+};
+typedef INPUT_TYPE InputType;
+
+#ifdef __cplusplus
+struct InputTypeEnum : util::Reflection<InputTypeEnum, InputType>
+{
+    static constexpr long minVal = 0;
+    static constexpr long maxVal = INPUT_DISK_EJECT;
+    static bool isValid(auto val) { return val >= minVal && val <= maxVal; }
+
+    static const char *prefix() { return "INPUT"; }
+    static const char *key(InputType value)
+    {
+        switch (value) {
+
+            case INPUT_KEY_PRESS:           return "KEY_PRESS";
+            case INPUT_KEY_RELEASE:         return "KEY_RELEASE";
+            case INPUT_KEY_RELEASE_ALL:     return "KEY_RELEASE_ALL";
+            case INPUT_SHIFT_LOCK:          return "SHIFT_LOCK";
+            case INPUT_RESTORE:             return "RESTORE";
+            case INPUT_TYPE_PRESS:          return "TYPE_PRESS";
+            case INPUT_TYPE_RELEASE:        return "TYPE_RELEASE";
+            case INPUT_TYPE_RELEASE_ALL:    return "TYPE_RELEASE_ALL";
+            case INPUT_TYPE_ABORT:          return "TYPE_ABORT";
+            case INPUT_JOYSTICK:            return "JOYSTICK";
+            case INPUT_MOUSE_XY:            return "MOUSE_XY";
+            case INPUT_MOUSE_DXDY:          return "MOUSE_DXDY";
+            case INPUT_MOUSE_LEFT:          return "MOUSE_LEFT";
+            case INPUT_MOUSE_RIGHT:         return "MOUSE_RIGHT";
+            case INPUT_DISK_INSERT:         return "DISK_INSERT";
+            case INPUT_DISK_EJECT:          return "DISK_EJECT";
+        }
+        return "???";
+    }
+};
+#endif
+
+
+//
+// Structures
+//
+
+typedef struct
+{
+    // Current state of the recorder
+    MovieState state;
+
+    // Number of input events in the movie
+    isize events;
+
+    // Number of input events that have been replayed
+    isize replayed;
+
+    // First and last cycle of the movie
+    i64 begin;
+    i64 end;
+}
+InputRecorderInfo;
@@ -0,0 +1,113 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "Profiler.h"
+#include "IOUtils.h"
+
+namespace vc64 {
+
+void
+Profiler::_dump(Category category, std::ostream& os) const
+{
+    using namespace util;
+
+    if (category == Category::Stats) {
+
+        if (!profileBuild) {
+
+            os << "The profiler is not available in this build." << std::endl;
+            os << "Define PROFILEBUILD in config.h to enable it." << std::endl;
+            return;
+        }
+
+        auto stats = getInfo();
+        auto frames = std::max(stats.frames, i64(1));
+
+        i64 sum = 0;
+        for (isize i = 0; i < PROF_COUNT; i++) sum += stats.total[i].nanos;
+        sum = std::max(sum, i64(1));
+
+        os << tab("Frames");
+        os << dec(stats.frames) << std::endl;
+        os << tab("Host time per frame");
+        os << flt(sum / 1000.0 / frames) << " usec" << std::endl;
+        os << std::endl;
+
+        for (isize i = 0; i < PROF_COUNT; i++) {
+
+            auto &total = stats.total[i];
+
+            os << tab(ProfilerPhaseEnum::key(ProfilerPhase(i)));
+            os << std::setw(10) << std::right << std::fixed << std::setprecision(1);
+            os << (total.nanos / 1000.0 / frames) << " usec  ";
+            os << std::setw(5) << (100.0 * total.nanos / sum) << " %  ";
+            os << std::setw(8) << (total.calls / frames) << " calls/frame";
+            os << std::endl;
+        }
+    }
+}
+
+ProfilerInfo
+Profiler::getInfo() const
+{
+    SYNCHRONIZED
+
+    return info;
+}
+
+void
+Profiler::csv(std::ostream& os) const
+{
+    auto stats = getInfo();
+
+    os << "phase,frames,nanos,calls,frame_nanos,frame_calls" << std::endl;
+
+    for (isize i = 0; i < PROF_COUNT; i++) {
+
+        os << ProfilerPhaseEnum::key(ProfilerPhase(i)) << ",";
+        os << stats.frames << ",";
+        os << stats.total[i].nanos << ",";
+        os << stats.total[i].calls << ",";
+        os << stats.frame[i].nanos << ",";
+        os << stats.frame[i].calls << std::endl;
+    }
+}
+
+void
+Profiler::endFrame()
+{
+    if constexpr (profileBuild) {
+
+        SYNCHRONIZED
+
+        for (isize i = 0; i < PROF_COUNT; i++) {
+
+            info.frame[i] = current[i];
+            info.total[i].nanos += current[i].nanos;
+            info.total[i].calls += current[i].calls;
+            current[i] = { };
+        }
+        info.frames++;
+    }
+}
+
+void
+Profiler::clear()
+{
+    SYNCHRONIZED
+
+    for (isize i = 0; i < PROF_COUNT; i++) current[i] = { };
+    info = { };
+}
+
+}
@@ -0,0 +1,155 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "ProfilerTypes.h"
+#include "SubComponent.h"
+#include "Chrono.h"
+
+namespace vc64 {
+
+/* The profiler attributes the host time spent in the run loop to the
+ * components of the virtual machine. It is only available in builds with
+ * PROFILEBUILD defined in config.h. In all other builds, lap() compiles to
+ * nothing and the run loop is not affected.
+ *
+ * Measuring works like a stop watch. Each call to lap() charges the time that
+ * has elapsed since the previous call to the specified phase. Hence, the time
+ * spent in the run loop between two components is charged to the component
+ * executed next.
+ */
+class Profiler : public SubComponent {
+
+    // Time stamp of the most recent lap
+    i64 lastLap = 0;
+
+    // Measurements of the frame that is currently emulated
+    ProfilerCounter current[PROF_COUNT] = { };
+
+    // Result of the latest inspection
+    mutable ProfilerInfo info = { };
+
+
+    //
+    // Constructing
+    //
+
+public:
+
+    using SubComponent::SubComponent;
+
+
+    //
+    // Methods from CoreObject
+    //
+
+private:
+
+    const char *getDescription() const override { return "Profiler"; }
+    void _dump(Category category, std::ostream& os) const override;
+
+
+    //
+    // Methods from CoreComponent
+    //
+
+private:
+
+    void _reset(bool hard) override { if (hard) clear(); }
+    isize _size() override { return 0; }
+    u64 _checksum() override { return 0; }
+    isize _load(const u8 *buffer) override { return 0; }
+    isize _save(u8 *buffer) override { return 0; }
+
+
+    //
+    // Analyzing
+    //
+
+public:
+
+    ProfilerInfo getInfo() const;
+
+    // Writes all measurements in CSV format
+    void csv(std::ostream& os) const;
+
+
+    //
+    // Measuring
+    //
+
+public:
+
+    // Starts the stop watch (called when the run loop is entered)
+    void start() {
+
+        if constexpr (profileBuild) {
+            lastLap = util::Time::now().asNanoseconds();
+        }
+    }
+
+    // Charges the time elapsed since the previous lap to a phase
+    void lap(ProfilerPhase phase) {
+
+        if constexpr (profileBuild) {
+
+            auto now = util::Time::now().asNanoseconds();
+            current[phase].nanos += now - lastLap;
+            current[phase].calls++;
+            lastLap = now;
+        }
+    }
+
+    // Returns a time stamp for measuring a nested phase
+    i64 stamp() const {
+
+        if constexpr (profileBuild) {
+            return util::Time::now().asNanoseconds();
+        }
+        return 0;
+    }
+
+    /* Charges the time elapsed since a time stamp to a nested phase. The time
+     * is removed from the current lap, so that the enclosing phase isn't
+     * charged twice. If two phases are given, the time is split evenly.
+     */
+    void charge(i64 start, ProfilerPhase phase1, ProfilerPhase phase2 = PROF_COUNT) {
+
+        if constexpr (profileBuild) {
+
+            auto elapsed = util::Time::now().asNanoseconds() - start;
+
+            if (phase2 == PROF_COUNT) {
+
+                current[phase1].nanos += elapsed;
+                current[phase1].calls++;
+
+            } else {
+
+                current[phase1].nanos += elapsed / 2;
+                current[phase1].calls++;
+                current[phase2].nanos += elapsed - elapsed / 2;
+                current[phase2].calls++;
+            }
+            lastLap += elapsed;
+        }
+    }
+
+    // Completes the measurements for the current frame
+    void endFrame();
+
+    // Deletes all measurements
+    void clear();
+};
+
+}
@@ -0,0 +1,94 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Aliases.h"
+#include "Reflection.h"
+
+//
+// Enumerations
+//
+
+enum_long(PROFILER_PHASE)
+{
+    PROF_EVENTS,                    // C64::processEvents()
+    PROF_VICII,                     // VICII cycle functions and end of frame
+    PROF_CPU,                       // C64 CPU
+    PROF_DRIVE8,                    // Drive 8 (execution and vsync handler)
+    PROF_DRIVE9,                    // Drive 9 (execution and vsync handler)
+    PROF_SID,                       // Muxer (remaining SID cycles)
+    PROF_IEC,                       // IEC bus
+    PROF_PORTS,                     // Expansion port and control ports
+    PROF_RECORDER,                  // Screen recorder
+    PROF_OTHER,                     // End of scanline bookkeeping
+
+    PROF_COUNT
+};
+typedef PROFILER_PHASE ProfilerPhase;
+
+#ifdef __cplusplus
+struct ProfilerPhaseEnum : util::Reflection<ProfilerPhaseEnum, ProfilerPhase>
+{
+    static constexpr long minVal = 0;
+    static constexpr long maxVal = PROF_COUNT - 1;
+    static bool isValid(auto val) { return val >= minVal && val <= maxVal; }
+
+    static const char *prefix() { return "PROF"; }
+    static const char *key(ProfilerPhase value)
+    {
+        switch (value) {
+
+            case PROF_EVENTS:       return "EVENTS";
+            case PROF_VICII:        return "VICII";
+            case PROF_CPU:          return "CPU";
+            case PROF_DRIVE8:       return "DRIVE8";
+            case PROF_DRIVE9:       return "DRIVE9";
+            case PROF_SID:          return "SID";
+            case PROF_IEC:          return "IEC";
+            case PROF_PORTS:        return "PORTS";
+            case PROF_RECORDER:     return "RECORDER";
+            case PROF_OTHER:        return "OTHER";
+            case PROF_COUNT:        return "???";
+        }
+        return "???";
+    }
+};
+#endif
+
+
+//
+// Structures
+//
+
+typedef struct
+{
+    // Consumed host time in nanoseconds
+    i64 nanos;
+
+    // Number of invocations
+    i64 calls;
+}
+ProfilerCounter;
+
+typedef struct
+{
+    // Number of profiled frames
+    i64 frames;
+
+    // Measurements of the most recently completed frame
+    ProfilerCounter frame[PROF_COUNT];
+
+    // Accumulated measurements since the last reset
+    ProfilerCounter total[PROF_COUNT];
+}
+ProfilerInfo;
@@ -88,7 +88,7 @@ RegressionTester::dumpTexture(C64 &c64, std::ostream& os)
 
     {   SUSPENDED
 
-        auto buffer = (u32 *)c64.vic.stableEmuTexture();
+        auto buffer = (u32 *)c64.vic.latestEmuTexture();
         char *cptr;
 
         for (isize y = Y1; y < Y2; y++) {
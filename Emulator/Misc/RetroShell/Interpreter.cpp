@@ -187,6 +187,14 @@ Interpreter::exec(const Arguments &argv, bool verbose)
     if ((isize)args.size() < current->minArgs()) throw TooFewArgumentsError(current->fullName);
     if ((isize)args.size() > current->maxArgs()) throw TooManyArgumentsError(current->fullName);
 
+    // Warn the user if the command might break a movie recording
+    if (inputRecorder.isRecording() && argv.front() != "movie") {
+
+        retroShell << "Warning: Shell commands are not recorded. The movie only ";
+        retroShell << "contains the keyboard, joystick, mouse, and disk input ";
+        retroShell << "they generate." << '\n';
+    }
+
     // Call the command handler
     current->callback(args, current->param);
 }
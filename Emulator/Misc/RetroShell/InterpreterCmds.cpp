@@ -107,6 +107,8 @@ Interpreter::initCommandShell(Command &root)
     root.add({"dmadebugger"},   "DMA Debugger");
     root.add({"sid"},           "Sound Interface Device");
     root.add({"expansion"},     "Expansion port");
+    root.add({"rewinder"},      "Rewind history");
+    root.add({"movie"},         "Input movie recorder");
 
     root.newGroup("Controlling peripherals");
 
@@ -241,6 +243,20 @@ Interpreter::initCommandShell(Command &root)
         c64.configure(OPT_PROPOSED_FPS, parseNum(argv));
     });
 
+    root.add({"c64", "set", "drivesync"}, { DriveSyncEnum::argList() },
+             "Selects how the floppy drives are synchronized with the C64",
+             [this](Arguments& argv, long value) {
+
+        c64.configure(OPT_DRIVE_SYNC, parseEnum <DriveSyncEnum> (argv));
+    });
+
+    root.add({"c64", "set", "runahead"}, { Arg::value },
+             "Sets the number of frames emulated ahead of time",
+             [this](Arguments& argv, long value) {
+
+        c64.configure(OPT_RUN_AHEAD, parseNum(argv));
+    });
+
     root.add({"c64", "power"}, { Arg::onoff },
              "Switches the C64 on or off",
              [this](Arguments& argv, long value) {
@@ -265,7 +281,136 @@ Interpreter::initCommandShell(Command &root)
         c64.configure(model);
     });
 
+    root.add({"c64", "snapshot"},
+             "Saves or restores the emulator state");
+
+    root.add({"c64", "snapshot", "save"}, { Arg::path },
+             "Saves a compressed snapshot to a file",
+             [this](Arguments& argv, long value) {
+
+        {   SUSPENDED
+
+            Snapshot snapshot(c64);
+            snapshot.compress();
+            snapshot.writeToFile(argv.front());
+        }
+    });
+
+    root.add({"c64", "snapshot", "load"}, { Arg::path },
+             "Restores a snapshot from a file",
+             [this](Arguments& argv, long value) {
+
+        auto path = argv.front();
+        if (!util::fileExists(path)) throw VC64Error(ERROR_FILE_NOT_FOUND, path);
+
+        c64.loadSnapshot(Snapshot(path));
+    });
+
     
+    //
+    // Rewinder
+    //
+
+    root.add({"rewinder", ""},
+             "Displays the current configuration",
+             [this](Arguments& argv, long value) {
+
+        retroShell.dump(c64.rewinder, { Category::Config, Category::State });
+    });
+
+    root.add({"rewinder", "set"},
+             "Configures the component");
+
+    root.add({"rewinder", "set", "history"}, { Arg::seconds },
+             "Sets the length of the rewind history (0 = off)",
+             [this](Arguments& argv, long value) {
+
+        c64.configure(OPT_REWIND_HISTORY, parseNum(argv));
+    });
+
+    root.add({"rewinder", "set", "rate"}, { Arg::value },
+             "Sets the number of recorded states per second",
+             [this](Arguments& argv, long value) {
+
+        c64.configure(OPT_REWIND_RATE, parseNum(argv));
+    });
+
+    root.add({"rewinder", "set", "memory"}, { Arg::value },
+             "Sets the memory limit in MB",
+             [this](Arguments& argv, long value) {
+
+        c64.configure(OPT_REWIND_MEMORY, parseNum(argv));
+    });
+
+    root.add({"rewinder", "rewind"}, { }, { Arg::value },
+             "Reverts to a recorded state (1 = most recent state)",
+             [this](Arguments& argv, long value) {
+
+        c64.rewind(argv.empty() ? 1 : parseNum(argv));
+    });
+
+    root.add({"rewinder", "clear"},
+             "Deletes the rewind history",
+             [this](Arguments& argv, long value) {
+
+        c64.rewinder.clear();
+    });
+
+
+    //
+    // Input recorder
+    //
+
+    root.add({"movie", ""},
+             "Displays the current state",
+             [this](Arguments& argv, long value) {
+
+        retroShell.dump(c64.inputRecorder, Category::State);
+    });
+
+    root.add({"movie", "events"},
+             "Lists all recorded input events",
+             [this](Arguments& argv, long value) {
+
+        retroShell.dump(c64.inputRecorder, Category::Events);
+    });
+
+    root.add({"movie", "record"},
+             "Starts recording a new movie",
+             [this](Arguments& argv, long value) {
+
+        c64.inputRecorder.record();
+    });
+
+    root.add({"movie", "replay"},
+             "Replays the current movie",
+             [this](Arguments& argv, long value) {
+
+        if (!c64.inputRecorder.replay()) retroShell << "No movie recorded\n";
+    });
+
+    root.add({"movie", "stop"},
+             "Stops recording or replaying",
+             [this](Arguments& argv, long value) {
+
+        c64.inputRecorder.stop();
+    });
+
+    root.add({"movie", "save"}, { Arg::path },
+             "Saves the current movie to a file",
+             [this](Arguments& argv, long value) {
+
+        c64.inputRecorder.save(argv.front());
+    });
+
+    root.add({"movie", "load"}, { Arg::path },
+             "Loads a movie from a file",
+             [this](Arguments& argv, long value) {
+
+        c64.inputRecorder.load(argv.front());
+    });
+
+
     //
     // Memory
     //
@@ -387,6 +532,20 @@ Interpreter::initCommandShell(Command &root)
         c64.configure(OPT_GLUE_LOGIC, parseBool(argv));
     });
 
+    root.add({"vicii", "set", "headless"}, { Arg::onoff },
+             "Skips pixel synthesis (no video output)",
+             [this](Arguments& argv, long value) {
+
+        c64.configure(OPT_VIC_HEADLESS, parseBool(argv));
+    });
+
+    root.add({"vicii", "set", "indexed"}, { Arg::onoff },
+             "Stores color indices and converts them to RGBA on demand",
+             [this](Arguments& argv, long value) {
+
+        c64.configure(OPT_VIC_INDEXED, parseBool(argv));
+    });
+
     root.add({"vicii", "set", "sscollisions"}, { Arg::onoff },
              "Enables or disables sprite-sprite collision detection",
              [this](Arguments& argv, long value) {
@@ -558,6 +717,13 @@ Interpreter::initCommandShell(Command &root)
         c64.configure(OPT_SID_FILTER, parseBool(argv));
     });
 
+    root.add({"sid", "set", "parallel"}, { Arg::onoff },
+             "Synthesizes multiple SIDs on separate threads",
+             [this](Arguments& argv, long value) {
+
+        c64.configure(OPT_SID_PARALLEL, parseBool(argv));
+    });
+
     root.add({"sid", "set", "volume"},
              "Sets the volume");
 
@@ -140,6 +140,30 @@ Interpreter::initDebugShell(Command &root)
         retroShell.dump(host, Category::State);
     });
 
+    root.add({"c64", "messages"},
+             "Displays the state of the message queue",
+             [this](Arguments& argv, long value) {
+
+        retroShell.dump(msgQueue, Category::State);
+    });
+
+    root.add({"c64", "profile"},
+             "Profiles the run loop");
+
+    root.add({"c64", "profile", ""},
+             "Displays the host time consumed by each component",
+             [this](Arguments& argv, long value) {
+
+        retroShell.dump(c64.profiler, Category::Stats);
+    });
+
+    root.add({"c64", "profile", "reset"},
+             "Deletes all measurements",
+             [this](Arguments& argv, long value) {
+
+        c64.profiler.clear();
+    });
+
 
     //
     // Memory
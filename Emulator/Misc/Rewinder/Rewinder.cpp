@@ -0,0 +1,309 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "Rewinder.h"
+#include "C64.h"
+#include "IOUtils.h"
+
+namespace vc64 {
+
+static void writeVarint(std::vector<u8> &out, isize value)
+{
+    while (value >= 0x80) { out.push_back(u8(value | 0x80)); value >>= 7; }
+    out.push_back(u8(value));
+}
+
+static isize readVarint(const u8 *&ptr)
+{
+    isize result = 0;
+    for (isize shift = 0; ; shift += 7) {
+
+        result |= isize(*ptr & 0x7F) << shift;
+        if (!(*ptr++ & 0x80)) return result;
+    }
+}
+
+void
+Rewinder::_dump(Category category, std::ostream& os) const
+{
+    using namespace util;
+
+    if (category == Category::Config) {
+
+        os << tab("History");
+        os << config.history << " seconds" << std::endl;
+        os << tab("Rate");
+        os << config.rate << " states per second" << std::endl;
+        os << tab("Memory limit");
+        os << config.memory << " MB" << std::endl;
+    }
+
+    if (category == Category::State) {
+
+        auto info = getInfo();
+
+        os << tab("Recorded states");
+        os << dec(info.states) << std::endl;
+        os << tab("Memory usage");
+        os << flt(info.bytes / 1024.0) << " KB" << std::endl;
+        os << tab("Oldest state");
+        os << "Frame " << dec(info.oldest) << std::endl;
+        os << tab("Latest state");
+        os << "Frame " << dec(info.latest) << std::endl;
+    }
+}
+
+void
+Rewinder::resetConfig()
+{
+    assert(isPoweredOff());
+    auto &defaults = c64.defaults;
+
+    std::vector <Option> options = {
+
+        OPT_REWIND_HISTORY,
+        OPT_REWIND_RATE,
+        OPT_REWIND_MEMORY
+    };
+
+    for (auto &option : options) {
+        setConfigItem(option, defaults.get(option));
+    }
+}
+
+i64
+Rewinder::getConfigItem(Option option) const
+{
+    switch (option) {
+
+        case OPT_REWIND_HISTORY:    return config.history;
+        case OPT_REWIND_RATE:       return config.rate;
+        case OPT_REWIND_MEMORY:     return config.memory;
+
+        default:
+            fatalError;
+    }
+}
+
+void
+Rewinder::setConfigItem(Option option, i64 value)
+{
+    switch (option) {
+
+        case OPT_REWIND_HISTORY:
+
+            if (value < 0 || value > 600) {
+                throw VC64Error(ERROR_OPT_INVARG, "0...600");
+            }
+
+            config.history = isize(value);
+            if (!config.history) clear();
+            trim();
+            return;
+
+        case OPT_REWIND_RATE:
+
+            if (value < 1 || value > 50) {
+                throw VC64Error(ERROR_OPT_INVARG, "1...50");
+            }
+
+            config.rate = isize(value);
+            trim();
+            return;
+
+        case OPT_REWIND_MEMORY:
+
+            if (value < 1 || value > 1024) {
+                throw VC64Error(ERROR_OPT_INVARG, "1...1024");
+            }
+
+            config.memory = isize(value);
+            trim();
+            return;
+
+        default:
+            fatalError;
+    }
+}
+
+RewinderInfo
+Rewinder::getInfo() const
+{
+    SYNCHRONIZED
+
+    RewinderInfo result = { };
+
+    result.states = count();
+    result.bytes = bytes();
+    result.oldest = deltas.empty() ? latestFrame : deltas.front().frame;
+    result.latest = latestFrame;
+
+    return result;
+}
+
+isize
+Rewinder::framesPerState() const
+{
+    return std::max(isize(1), isize(std::round(vic.getFps() / config.rate)));
+}
+
+void
+Rewinder::vsyncHandler()
+{
+    if (!config.history) return;
+
+    if (++frameCounter >= framesPerState()) {
+
+        frameCounter = 0;
+        record();
+    }
+}
+
+void
+Rewinder::record()
+{
+    SYNCHRONIZED
+
+    // Save the current state
+    scratch.alloc(c64.size());
+    c64.saveUnchecked(scratch.ptr);
+
+    // Turn the previously recorded state into a delta
+    if (!latest.empty()) {
+
+        bool sameSize = latest.size == scratch.size;
+        Delta delta = { latestFrame, latest.size, { } };
+
+        encode(latest.ptr, sameSize ? scratch.ptr : nullptr, latest.size, delta.data);
+        delta.data.shrink_to_fit();
+
+        deltaBytes += isize(delta.data.size());
+        deltas.push_back(std::move(delta));
+    }
+
+    // Keep the new state in full
+    latest.init(scratch.ptr, scratch.size);
+    latestFrame = i64(c64.frame);
+
+    trim();
+}
+
+bool
+Rewinder::rewind(isize steps)
+{
+    SYNCHRONIZED
+
+    assert(!isRunning());
+
+    if (latest.empty() || steps < 1) return false;
+    steps = std::min(steps, count());
+
+    // Reconstruct the selected state
+    for (isize i = 1; i < steps; i++) {
+
+        auto &delta = deltas.back();
+
+        if (delta.size != latest.size) latest.init(delta.size);
+        apply(delta.data, latest.ptr);
+        latestFrame = delta.frame;
+
+        deltaBytes -= isize(delta.data.size());
+        deltas.pop_back();
+    }
+
+    // Restore the state
+    c64.loadUnchecked(latest.ptr);
+    c64.didLoad();
+
+    frameCounter = 0;
+    return true;
+}
+
+void
+Rewinder::clear()
+{
+    SYNCHRONIZED
+
+    deltas.clear();
+    deltaBytes = 0;
+    latest.dealloc();
+    scratch.dealloc();
+    latestFrame = 0;
+    frameCounter = 0;
+}
+
+void
+Rewinder::trim()
+{
+    SYNCHRONIZED
+
+    auto maxStates = std::max(config.history * config.rate, isize(1));
+    auto maxBytes = config.memory * 1024 * 1024;
+
+    while (!deltas.empty() && (count() > maxStates || bytes() > maxBytes)) {
+
+        deltaBytes -= isize(deltas.front().data.size());
+        deltas.pop_front();
+    }
+}
+
+void
+Rewinder::encode(const u8 *state, const u8 *base, isize size, std::vector<u8> &out)
+{
+    auto diff = [&](isize i) { return base ? u8(state[i] ^ base[i]) : state[i]; };
+
+    isize pos = 0, mark = 0;
+
+    while (pos < size) {
+
+        // Skip unmodified pages
+        if (base && pos % pageSize == 0 && pos + pageSize <= size &&
+            std::memcmp(state + pos, base + pos, pageSize) == 0) {
+
+            pos += pageSize;
+            continue;
+        }
+
+        // Skip unmodified bytes
+        if (!diff(pos)) { pos++; continue; }
+
+        // Find the end of the modified area
+        isize end = pos, gap = 0;
+        for (; end < size && gap < minGap; end++) gap = diff(end) ? 0 : gap + 1;
+        end -= gap;
+
+        // Write the distance to the previous area, the length, and the data
+        writeVarint(out, pos - mark);
+        writeVarint(out, end - pos);
+        for (isize i = pos; i < end; i++) out.push_back(diff(i));
+
+        pos = mark = end;
+    }
+}
+
+void
+Rewinder::apply(const std::vector<u8> &delta, u8 *state)
+{
+    const u8 *ptr = delta.data();
+    const u8 *end = ptr + delta.size();
+    isize pos = 0;
+
+    while (ptr < end) {
+
+        pos += readVarint(ptr);
+        auto len = readVarint(ptr);
+        for (isize i = 0; i < len; i++) state[pos++] ^= *ptr++;
+    }
+}
+
+}
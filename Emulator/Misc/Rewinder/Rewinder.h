@@ -0,0 +1,175 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "RewinderTypes.h"
+#include "SubComponent.h"
+#include <deque>
+
+namespace vc64 {
+
+/* The rewinder keeps a history of emulator states which are recorded in
+ * regular intervals while the emulator is running. To keep the memory
+ * footprint small, only the most recent state is stored in full. All other
+ * states are stored as deltas.
+ *
+ * A delta is the XOR difference of a state and its successor. It is stored
+ * in a run-length encoded format which only contains the modified areas.
+ * Unmodified pages are skipped with a single memory comparison. Applying a
+ * delta to the successor reproduces the state. If two states differ in size
+ * (e.g., because a disk has been inserted), the delta is taken against an
+ * all-zero buffer which means that the state is stored in full.
+ *
+ * The history is bounded in both length and memory consumption. If a limit
+ * is exceeded, the oldest states are discarded.
+ */
+class Rewinder : public SubComponent {
+
+    // The page size used to skip unmodified areas
+    static constexpr isize pageSize = 256;
+
+    // Minimum number of unmodified bytes separating two modified areas
+    static constexpr isize minGap = 4;
+
+    struct Delta {
+
+        // Frame in which the state has been recorded
+        i64 frame;
+
+        // Size of the state in bytes
+        isize size;
+
+        // XOR difference to the successor state (run-length encoded)
+        std::vector<u8> data;
+    };
+
+    // Current configuration
+    RewinderConfig config = { };
+
+    // All states except the most recent one (oldest first)
+    std::deque<Delta> deltas;
+
+    // Memory occupied by all deltas
+    isize deltaBytes = 0;
+
+    // The most recent state
+    util::Buffer<u8> latest;
+
+    // Frame in which the most recent state has been recorded
+    i64 latestFrame = 0;
+
+    // Buffer for recording new states
+    util::Buffer<u8> scratch;
+
+    // Number of frames emulated since the most recent state has been recorded
+    isize frameCounter = 0;
+
+
+    //
+    // Constructing
+    //
+
+public:
+
+    using SubComponent::SubComponent;
+
+
+    //
+    // Methods from CoreObject
+    //
+
+private:
+
+    const char *getDescription() const override { return "Rewinder"; }
+    void _dump(Category category, std::ostream& os) const override;
+
+
+    //
+    // Methods from CoreComponent
+    //
+
+private:
+
+    void _reset(bool hard) override { if (hard) clear(); }
+    isize _size() override { return 0; }
+    u64 _checksum() override { return 0; }
+    isize _load(const u8 *buffer) override { return 0; }
+    isize _save(u8 *buffer) override { return 0; }
+
+
+    //
+    // Configuring
+    //
+
+public:
+
+    const RewinderConfig &getConfig() const { return config; }
+    void resetConfig() override;
+
+    i64 getConfigItem(Option option) const;
+    void setConfigItem(Option option, i64 value);
+
+
+    //
+    // Analyzing
+    //
+
+public:
+
+    RewinderInfo getInfo() const;
+
+    // Returns the number of recorded states
+    isize count() const { return latest.empty() ? 0 : isize(deltas.size()) + 1; }
+
+    // Returns the memory occupied by the history in bytes
+    isize bytes() const { return latest.size + deltaBytes; }
+
+
+    //
+    // Recording and restoring states
+    //
+
+public:
+
+    // Records a new state if one is due (called at the end of each frame)
+    void vsyncHandler();
+
+    /* Reverts the emulator to a previously recorded state. A value of 1
+     * selects the most recent state. The selected state becomes the most
+     * recent one and all newer states are discarded. The function must not
+     * be called while the emulator is running.
+     */
+    bool rewind(isize steps);
+
+    // Deletes all recorded states
+    void clear();
+
+private:
+
+    // Returns the number of frames between two recorded states
+    isize framesPerState() const;
+
+    // Records the current emulator state
+    void record();
+
+    // Discards the oldest states until the history fits the limits
+    void trim();
+
+    // Encodes the XOR difference of a state and a base state (or zeroes)
+    static void encode(const u8 *state, const u8 *base, isize size, std::vector<u8> &out);
+
+    // Applies an encoded XOR difference to a state
+    static void apply(const std::vector<u8> &delta, u8 *state);
+};
+
+}
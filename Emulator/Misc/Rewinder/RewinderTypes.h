@@ -0,0 +1,46 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Aliases.h"
+
+//
+// Structures
+//
+
+typedef struct
+{
+    // Length of the rewind history in seconds (0 = rewinding disabled)
+    isize history;
+
+    // Number of recorded states per second
+    isize rate;
+
+    // Maximum amount of memory occupied by the history in MB
+    isize memory;
+}
+RewinderConfig;
+
+typedef struct
+{
+    // Number of recorded states
+    isize states;
+
+    // Memory occupied by the history in bytes
+    isize bytes;
+
+    // Frame numbers of the oldest and the most recent state
+    i64 oldest;
+    i64 latest;
+}
+RewinderInfo;
@@ -27,6 +27,7 @@ class FileSystem;
 class Disk : public CoreObject {
     
     friend class Drive;
+    friend class InputRecorder;
     
 public:
     
@@ -527,6 +527,48 @@ Drive::execute(u64 duration)
     assert(nextClock >= (i64)elapsedTime && nextCarry >= (i64)elapsedTime);
 }
 
+isize
+Drive::execute(isize cycles, u64 duration)
+{
+    assert(cycles > 0);
+
+    auto start = (i64)elapsedTime;
+    auto target = start + cycles * (i64)duration;
+    bool stopping = false;
+
+    while (nextClock < target || nextCarry < target) {
+
+        if (nextClock <= nextCarry) {
+
+            // Execute CPU and VIAs
+            i64 cycle = ++cpu.clock;
+            cpu.execute<MOS_6502>();
+            if (cycle >= via1.wakeUpCycle) via1.execute(); else via1.idleCounter++;
+            if (cycle >= via2.wakeUpCycle) via2.execute(); else via2.idleCounter++;
+            updateByteReady();
+
+            // Stop at the end of the current C64 cycle if the bus needs an update
+            if (iec.pendingUpdate && !stopping) {
+
+                cycles = (nextClock - start) / (i64)duration + 1;
+                target = start + cycles * (i64)duration;
+                stopping = true;
+            }
+            nextClock += 10000;
+
+        } else {
+
+            // Execute read/write logic
+            if (spinning) executeUF4();
+            nextCarry += delayBetweenTwoCarryPulses[zone];
+        }
+    }
+    elapsedTime = u64(target);
+
+    assert(nextClock >= (i64)elapsedTime && nextCarry >= (i64)elapsedTime);
+    return cycles;
+}
+
 void
 Drive::executeUF4()
 {
@@ -819,15 +861,23 @@ Drive::insertDisk(std::unique_ptr<Disk> disk)
 {
     debug(DSKCHG_DEBUG, "insertDisk\n");
 
+    if (inputRecorder.capture(deviceNr, *disk)) return;
+
     {   SUSPENDED
         
-        if (!diskToInsert) {
+        scheduleInsertion(std::move(disk));
+    }
+}
 
-            diskToInsert = std::move(disk);
+void
+Drive::scheduleInsertion(std::unique_ptr<Disk> disk)
+{
+    if (!diskToInsert) {
 
-            // Initiate the disk change procedure
-            scheduleFirstDiskChangeEvent(DCH_INSERT);
-        }
+        diskToInsert = std::move(disk);
+
+        // Initiate the disk change procedure
+        scheduleFirstDiskChangeEvent(DCH_INSERT);
     }
 }
 
@@ -866,13 +916,21 @@ Drive::ejectDisk()
 {
     debug(DSKCHG_DEBUG, "ejectDisk()\n");
 
+    if (inputRecorder.capture(INPUT_DISK_EJECT, deviceNr)) return;
+
     {   SUSPENDED
         
-        if (insertionStatus == DISK_FULLY_INSERTED && !diskToInsert) {
+        scheduleEjection();
+    }
+}
 
-            // Initiate the disk change procedure
-            scheduleFirstDiskChangeEvent(DCH_EJECT);
-        }
+void
+Drive::scheduleEjection()
+{
+    if (insertionStatus == DISK_FULLY_INSERTED && !diskToInsert) {
+
+        // Initiate the disk change procedure
+        scheduleFirstDiskChangeEvent(DCH_EJECT);
     }
 }
 
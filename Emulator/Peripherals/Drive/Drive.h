@@ -406,6 +406,13 @@ public:
     void insertFileSystem(const class FileSystem &device, bool wp);
     void ejectDisk();
 
+    /* Initiates a disk change without suspending the emulator. These functions
+     * must be called from within the emulator thread or while the emulator is
+     * suspended.
+     */
+    void scheduleInsertion(std::unique_ptr<Disk> disk);
+    void scheduleEjection();
+
 
     //
     // Emulating
@@ -418,6 +425,14 @@ public:
      */
     void execute(u64 duration);
 
+    /* Executes the virtual drive for the specified number of C64 cycles. This
+     * function is utilized in catch-up mode. It stops prematurely if the
+     * drive writes to the IEC bus. In this case, the drive is emulated until
+     * the end of the C64 cycle in which the write happened. The function
+     * returns the number of emulated C64 cycles.
+     */
+    isize execute(isize cycles, u64 duration);
+
 private:
     
     // Emulates a trigger event on the carry output pin of UE7.
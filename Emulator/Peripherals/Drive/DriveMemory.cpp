@@ -18,6 +18,16 @@
 
 namespace vc64 {
 
+/* Values read from unmapped pages. The pattern matches the value returned by
+ * peek(u16, DrvMemType) and repeats every 8KB.
+ */
+static constexpr auto floatingBus = []() {
+
+    std::array<u8, 0x2000> result { };
+    for (isize i = 0; i < 0x2000; i++) result[i] = u8(i >> 8 & 0x1F);
+    return result;
+}();
+
 DriveMemory::DriveMemory(C64 &ref, Drive &dref) : SubComponent(ref), drive(dref)
 {
     updateBankMap();
@@ -213,11 +223,11 @@ DriveMemory::saveRom(const string &path)
 }
 
 u8
-DriveMemory::peek(u16 addr)
+DriveMemory::peek(u16 addr, DrvMemType source)
 {
     u8 result;
     
-    switch (usage[addr >> 10]) {
+    switch (source) {
             
         case DRVMEM_NONE:
             
@@ -311,9 +321,9 @@ DriveMemory::spypeek(u16 addr) const
 }
 
 void 
-DriveMemory::poke(u16 addr, u8 value)
+DriveMemory::poke(u16 addr, u8 value, DrvMemType target)
 {
-    switch (usage[addr >> 10]) {
+    switch (target) {
 
         case DRVMEM_RAM:
             
@@ -395,6 +405,47 @@ DriveMemory::updateBankMap()
         
         for (isize i = 20; i < 24; i++) usage[i] = DRVMEM_PIA;
     }
+
+    updatePagePointers();
+}
+
+void
+DriveMemory::updatePagePointers()
+{
+
+    for (isize page = 0; page < 64; page++) {
+
+        auto offset = page << 10;
+
+        switch (usage[page]) {
+
+            case DRVMEM_NONE:
+
+                peekPtr[page] = floatingBus.data() + (offset & 0x1FFF);
+                pokePtr[page] = nullptr;
+                break;
+
+            case DRVMEM_RAM:
+
+                peekPtr[page] = pokePtr[page] = ram + (offset & 0x07FF);
+                break;
+
+            case DRVMEM_EXP:
+
+                peekPtr[page] = pokePtr[page] = ram + offset;
+                break;
+
+            case DRVMEM_ROM:
+
+                peekPtr[page] = rom + (offset & 0x7FFF);
+                pokePtr[page] = nullptr;
+                break;
+
+            default:
+
+                peekPtr[page] = pokePtr[page] = nullptr;
+        }
+    }
 }
 
 }
@@ -43,6 +43,14 @@ public:
 
     // Memory usage table (one entry for each KB)
     DrvMemType usage[64];
+
+    /* Page pointer tables (one entry for each KB). For RAM and ROM pages, the
+     * entries point to the memory cells backing the page. Unmapped pages are
+     * read from a table holding the floating bus values. I/O pages have a
+     * nullptr entry and are resolved via the usage table.
+     */
+    const u8 *peekPtr[64];
+    u8 *pokePtr[64];
     
     
     //
@@ -71,6 +79,7 @@ private:
 private:
 
     void _reset(bool hard) override;
+    void _didLoad() override { updatePagePointers(); }
     
     template <class T>
     void serialize(T& worker)
@@ -132,7 +141,11 @@ public:
 public:
 
     // Reads a value from memory
-    u8 peek(u16 addr);
+    u8 peek(u16 addr, DrvMemType source);
+    u8 peek(u16 addr) {
+        auto page = peekPtr[addr >> 10];
+        return page ? page[addr & 0x3FF] : peek(addr, usage[addr >> 10]);
+    }
     u8 peekZP(u8 addr) { return ram[addr]; }
     u8 peekStack(u8 sp) { return ram[0x100 + sp]; }
     
@@ -146,12 +159,22 @@ public:
     u8 spypeek(u16 addr) const;
 
     // Writes a value into memory
-    void poke(u16 addr, u8 value);
+    void poke(u16 addr, u8 value, DrvMemType target);
+    void poke(u16 addr, u8 value) {
+        if (auto page = pokePtr[addr >> 10]) {
+            page[addr & 0x3FF] = value;
+        } else {
+            poke(addr, value, usage[addr >> 10]);
+        }
+    }
     void pokeZP(u8 addr, u8 value) { ram[addr] = value; }
     void pokeStack(u8 sp, u8 value) { ram[0x100 + sp] = value; }
 
     // Updates the bank map
     void updateBankMap();
+
+    // Derives the page pointer tables from the bank map
+    void updatePagePointers();
 };
 
 }
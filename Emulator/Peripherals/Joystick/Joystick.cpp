@@ -164,7 +164,11 @@ void
 Joystick::trigger(GamePadAction event)
 {
     debug(PRT_DEBUG, "Port %ld: %s\n", port.nr, GamePadActionEnum::key(event));
-    
+
+    if (inputRecorder.capture(INPUT_JOYSTICK, port.nr, event)) return;
+
+    SYNCHRONIZED
+
     switch (event) {
 
         case PULL_UP:    axisY = -1; break;
@@ -189,6 +189,8 @@ Keyboard::press(C64Key key)
     assert(key.row < 8);
     assert(key.col < 8);
 
+    if (inputRecorder.capture(INPUT_KEY_PRESS, key.nr)) return;
+
     SYNCHRONIZED
 
     if (GET_BIT(kbMatrixRow[key.row], key.col)) {
@@ -204,6 +206,8 @@ Keyboard::press(C64Key key)
 void
 Keyboard::pressShiftLock()
 {
+    if (inputRecorder.capture(INPUT_SHIFT_LOCK, 0, 1)) return;
+
     SYNCHRONIZED
 
     shiftLock = true;
@@ -212,6 +216,8 @@ Keyboard::pressShiftLock()
 void
 Keyboard::pressRestore()
 {
+    if (inputRecorder.capture(INPUT_RESTORE, 0, 1)) return;
+
     SYNCHRONIZED
 
     cpu.pullDownNmiLine(INTSRC_KBD);
@@ -232,6 +238,8 @@ Keyboard::release(C64Key key)
     assert(key.row < 8);
     assert(key.col < 8);
 
+    if (inputRecorder.capture(INPUT_KEY_RELEASE, key.nr)) return;
+
     SYNCHRONIZED
 
     // Only release right shift key if shift lock is not pressed
@@ -249,6 +257,8 @@ Keyboard::release(C64Key key)
 void
 Keyboard::releaseShiftLock()
 {
+    if (inputRecorder.capture(INPUT_SHIFT_LOCK, 0, 0)) return;
+
     SYNCHRONIZED
 
     shiftLock = false;
@@ -257,6 +267,8 @@ Keyboard::releaseShiftLock()
 void
 Keyboard::releaseRestore()
 {
+    if (inputRecorder.capture(INPUT_RESTORE, 0, 0)) return;
+
     SYNCHRONIZED
 
     cpu.releaseNmiLine(INTSRC_KBD);
@@ -265,6 +277,8 @@ Keyboard::releaseRestore()
 void
 Keyboard::releaseAll()
 {
+    if (inputRecorder.capture(INPUT_KEY_RELEASE_ALL)) return;
+
     SYNCHRONIZED
 
     debug(KBD_DEBUG, "releaseAll()\n");
@@ -291,6 +305,8 @@ Keyboard::autoType(const string &text)
 void
 Keyboard::scheduleKeyPress(std::vector<C64Key> keys, double delay)
 {
+    if (inputRecorder.capture(INPUT_TYPE_PRESS, keys, delay)) return;
+
     SYNCHRONIZED
 
     actions.push(KeyAction(KeyAction::Action::wait, SEC(delay)));
@@ -302,6 +318,8 @@ Keyboard::scheduleKeyPress(std::vector<C64Key> keys, double delay)
 void
 Keyboard::scheduleKeyRelease(std::vector<C64Key> keys, double delay)
 {
+    if (inputRecorder.capture(INPUT_TYPE_RELEASE, keys, delay)) return;
+
     SYNCHRONIZED
 
     actions.push(KeyAction(KeyAction::Action::wait, SEC(delay)));
@@ -313,6 +331,8 @@ Keyboard::scheduleKeyRelease(std::vector<C64Key> keys, double delay)
 void
 Keyboard::scheduleKeyReleaseAll(double delay)
 {
+    if (inputRecorder.capture(INPUT_TYPE_RELEASE_ALL, std::vector<C64Key> { }, delay)) return;
+
     SYNCHRONIZED
 
     actions.push(KeyAction(KeyAction::Action::wait, SEC(delay)));
@@ -324,6 +344,8 @@ Keyboard::scheduleKeyReleaseAll(double delay)
 void
 Keyboard::abortAutoTyping()
 {
+    if (inputRecorder.capture(INPUT_TYPE_ABORT)) return;
+
     SYNCHRONIZED
 
     if (!actions.empty()) {
@@ -151,6 +151,10 @@ Mouse::setXY(double x, double y)
 {
     debug(PRT_DEBUG, "setXY(%f,%f)\n", x, y);
 
+    if (inputRecorder.capture(INPUT_MOUSE_XY, port.nr, x, y)) return;
+
+    SYNCHRONIZED
+
     targetX = x * scaleX;
     targetY = y * scaleX;
     
@@ -162,6 +166,10 @@ Mouse::setDxDy(double dx, double dy)
 {
     debug(PRT_DEBUG, "setDxDy(%f,%f)\n", dx, dy);
 
+    if (inputRecorder.capture(INPUT_MOUSE_DXDY, port.nr, dx, dy)) return;
+
+    SYNCHRONIZED
+
     targetX += dx * scaleX;
     targetY -= dy * scaleY;
     
@@ -172,6 +180,10 @@ void
 Mouse::setLeftButton(bool value)
 {
     debug(PRT_DEBUG, "setLeftButton(%d)\n", value);
+
+    if (inputRecorder.capture(INPUT_MOUSE_LEFT, port.nr, value)) return;
+
+    SYNCHRONIZED
     
     switch(config.model) {
             
@@ -190,6 +202,10 @@ Mouse::setRightButton(bool value)
 {
     debug(PRT_DEBUG, "setRightButton(%d)\n", value);
 
+    if (inputRecorder.capture(INPUT_MOUSE_RIGHT, port.nr, value)) return;
+
+    SYNCHRONIZED
+
     switch(config.model) {
             
         case MOUSE_C1350: mouse1350.setRightMouseButton(value); break;
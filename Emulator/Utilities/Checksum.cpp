@@ -16,20 +16,6 @@
 
 namespace util {
 
-u32
-NO_SANITIZE("unsigned-integer-overflow")
-fnvIt32(u32 prv, u32 val)
-{
-    return (prv ^ val) * 0x1000193;
-}
-
-u64
-NO_SANITIZE("unsigned-integer-overflow")
-fnvIt64(u64 prv, u64 val)
-{
-    return (prv ^ val) * 0x100000001b3;
-}
-
 u32
 fnv32(const u8 *addr, isize size)
 {
@@ -13,6 +13,7 @@
 #pragma once
 
 #include "Types.h"
+#include "Macros.h"
 
 namespace util {
 
@@ -21,8 +22,10 @@ inline u32 fnvInit32() { return 0x811c9dc5; }
 inline u64 fnvInit64() { return 0xcbf29ce484222325; }
 
 // Performs a single iteration of the FNV-1a hash algorithm
-u32 fnvIt32(u32 prv, u32 val);
-u64 fnvIt64(u64 prv, u64 val);
+inline u32 NO_SANITIZE("unsigned-integer-overflow")
+fnvIt32(u32 prv, u32 val) { return (prv ^ val) * 0x1000193; }
+inline u64 NO_SANITIZE("unsigned-integer-overflow")
+fnvIt64(u64 prv, u64 val) { return (prv ^ val) * 0x100000001b3; }
 
 // Computes a FNV-1a checksum for a given buffer
 u32 fnv32(const u8 *addr, isize size);
@@ -0,0 +1,135 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "Compression.h"
+#include <algorithm>
+#include <cstring>
+
+namespace util {
+
+// Minimum length of a back reference
+static constexpr isize minMatch = 4;
+
+// Maximum distance of a back reference
+static constexpr isize maxOffset = 0xFFFF;
+
+// Size of the hash table used to find back references
+static constexpr isize hashBits = 16;
+
+static void writeLength(std::vector<u8> &dst, isize len)
+{
+    for (; len >= 255; len -= 255) dst.push_back(255);
+    dst.push_back(u8(len));
+}
+
+static bool readLength(const u8 *&src, const u8 *end, isize &len)
+{
+    u8 byte;
+
+    do {
+
+        if (src == end) return false;
+        byte = *src++;
+        len += byte;
+
+    } while (byte == 255);
+
+    return true;
+}
+
+static void writeBlock(std::vector<u8> &dst, const u8 *literals, isize numLiterals, isize offset, isize matchLen)
+{
+    isize litCode = std::min(numLiterals, isize(15));
+    isize matchCode = offset ? std::min(matchLen - minMatch, isize(15)) : 0;
+
+    dst.push_back(u8(litCode << 4 | matchCode));
+    if (litCode == 15) writeLength(dst, numLiterals - 15);
+    dst.insert(dst.end(), literals, literals + numLiterals);
+
+    if (offset) {
+
+        dst.push_back(u8(offset >> 8));
+        dst.push_back(u8(offset));
+        if (matchCode == 15) writeLength(dst, matchLen - minMatch - 15);
+    }
+}
+
+void
+compress(const u8 *src, isize len, std::vector<u8> &dst)
+{
+    std::vector<isize> table(isize(1) << hashBits, -1);
+    isize pos = 0, anchor = 0;
+
+    while (pos + minMatch <= len) {
+
+        u32 seq; std::memcpy(&seq, src + pos, sizeof(seq));
+        auto hash = (seq * 2654435761U) >> (32 - hashBits);
+        auto ref = table[hash];
+        table[hash] = pos;
+
+        if (ref < 0 || pos - ref > maxOffset || std::memcmp(src + ref, src + pos, minMatch)) {
+            pos++;
+            continue;
+        }
+
+        // Extend the match as far as possible
+        isize matchLen = minMatch;
+        while (pos + matchLen < len && src[ref + matchLen] == src[pos + matchLen]) matchLen++;
+
+        writeBlock(dst, src + anchor, pos - anchor, pos - ref, matchLen);
+        pos += matchLen;
+        anchor = pos;
+    }
+
+    // Write the remaining bytes as literals
+    writeBlock(dst, src + anchor, len - anchor, 0, 0);
+}
+
+bool
+uncompress(const u8 *src, isize len, u8 *dst, isize dstLen)
+{
+    const u8 *end = src + len;
+    isize pos = 0;
+
+    while (src < end) {
+
+        u8 token = *src++;
+
+        // Copy the literals
+        isize numLiterals = token >> 4;
+        if (numLiterals == 15 && !readLength(src, end, numLiterals)) return false;
+        if (numLiterals > end - src || numLiterals > dstLen - pos) return false;
+
+        std::memcpy(dst + pos, src, numLiterals);
+        src += numLiterals;
+        pos += numLiterals;
+
+        // The last block ends after the literals
+        if (src == end) break;
+
+        // Copy the back reference
+        if (end - src < 2) return false;
+        isize offset = src[0] << 8 | src[1];
+        src += 2;
+
+        isize matchLen = (token & 0xF) + minMatch;
+        if ((token & 0xF) == 15 && !readLength(src, end, matchLen)) return false;
+        if (offset == 0 || offset > pos || matchLen > dstLen - pos) return false;
+
+        for (isize i = 0; i < matchLen; i++, pos++) dst[pos] = dst[pos - offset];
+    }
+
+    return pos == dstLen;
+}
+
+}
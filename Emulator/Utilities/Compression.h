@@ -0,0 +1,36 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Types.h"
+#include <vector>
+
+namespace util {
+
+/* A byte-oriented LZ77 codec. The compressed stream is a sequence of blocks.
+ * Each block consists of a token byte, a run of literals, and a back
+ * reference into the already decoded data. The upper nibble of the token
+ * encodes the number of literals, the lower nibble the length of the back
+ * reference minus 4. A nibble value of 15 indicates that the length continues
+ * with additional bytes which are added up until a byte differs from 255.
+ * Back references are stored as 16-bit big-endian offsets. The last block
+ * ends after the literals.
+ */
+
+// Compresses a memory block and appends the result to a vector
+void compress(const u8 *src, isize len, std::vector<u8> &dst);
+
+// Uncompresses a memory block (returns false if the data is corrupted)
+bool uncompress(const u8 *src, isize len, u8 *dst, isize dstLen);
+
+}
@@ -35,6 +35,7 @@ class ReentrantMutex
 public:
         
     void lock() { mutex.lock(); }
+    bool tryLock() { return mutex.try_lock(); }
     void unlock() { mutex.unlock(); }
 };
 
@@ -0,0 +1,141 @@
+// -----------------------------------------------------------------------------
+// This file is part of VirtualC64
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// This FILE is dual-licensed. You are free to choose between:
+//
+//     - The GNU General Public License v3 (or any later version)
+//     - The Mozilla Public License v2
+//
+// SPDX-License-Identifier: GPL-3.0-or-later OR MPL-2.0
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Types.h"
+#include <atomic>
+
+namespace util {
+
+/* A bounded queue that can be accessed by multiple producer and consumer
+ * threads without locking. Each cell carries a sequence number telling the
+ * threads whether the cell is ready to be written or ready to be read (the
+ * algorithm is Dmitry Vyukov's bounded MPMC queue). Neither put() nor get()
+ * ever waits for another thread. put() fails if the queue is full and get()
+ * fails if the queue is empty.
+ */
+template <class T, isize capacity> class ConcurrentQueue
+{
+    static_assert((capacity & (capacity - 1)) == 0, "Capacity must be a power of 2");
+
+    struct Cell {
+
+        std::atomic<isize> sequence;
+        T data;
+    };
+
+    // Element storage
+    Cell *cells = new Cell[capacity];
+
+    // Positions of the next write and read operation
+    std::atomic<isize> head = 0;
+    std::atomic<isize> tail = 0;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    ConcurrentQueue()
+    {
+        for (isize i = 0; i < capacity; i++) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~ConcurrentQueue() { delete[] cells; }
+
+
+    //
+    // Querying the fill status
+    //
+
+    isize cap() const { return capacity; }
+    bool isEmpty() const
+    {
+        return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+    }
+
+
+    //
+    // Reading and writing elements
+    //
+
+    bool put(const T &element)
+    {
+        auto pos = head.load(std::memory_order_relaxed);
+
+        while (true) {
+
+            auto &cell = cells[pos & (capacity - 1)];
+            auto diff = cell.sequence.load(std::memory_order_acquire) - pos;
+
+            if (diff == 0) {
+
+                // The cell is free. Try to claim it
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+
+                    cell.data = element;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+
+            } else if (diff < 0) {
+
+                // The queue is full
+                return false;
+
+            } else {
+
+                // Another producer has claimed the cell
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool get(T &element)
+    {
+        auto pos = tail.load(std::memory_order_relaxed);
+
+        while (true) {
+
+            auto &cell = cells[pos & (capacity - 1)];
+            auto diff = cell.sequence.load(std::memory_order_acquire) - (pos + 1);
+
+            if (diff == 0) {
+
+                // The cell has been written. Try to claim it
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+
+                    element = cell.data;
+                    cell.sequence.store(pos + capacity, std::memory_order_release);
+                    return true;
+                }
+
+            } else if (diff < 0) {
+
+                // The queue is empty
+                return false;
+
+            } else {
+
+                // Another consumer has claimed the cell
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+
+}
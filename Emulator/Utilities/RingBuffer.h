@@ -13,6 +13,7 @@
 #pragma once
 
 #include "Types.h"
+#include <atomic>
 #include <utility>
 
 namespace util {
@@ -164,13 +165,35 @@ struct SortedArray : public Array<T, capacity>
 // Ringbuffer
 //
 
-template <class T, isize capacity> struct RingBuffer
+/* Index type for ring buffers that are shared by a producer thread and a
+ * consumer thread. Reading an index has acquire semantics and writing an
+ * index has release semantics. Hence, a single producer and a single consumer
+ * can access the ring buffer concurrently without locking, as long as the
+ * producer only modifies the write pointer and the consumer only modifies the
+ * read pointer.
+ */
+class SharedIndex
+{
+    std::atomic<isize> value;
+
+public:
+
+    SharedIndex(isize v = 0) : value(v) { }
+    SharedIndex(const SharedIndex &other) : value(isize(other)) { }
+
+    operator isize() const { return value.load(std::memory_order_acquire); }
+
+    SharedIndex &operator=(isize v) { value.store(v, std::memory_order_release); return *this; }
+    SharedIndex &operator=(const SharedIndex &other) { return *this = isize(other); }
+};
+
+template <class T, isize capacity, class Index = isize> struct RingBuffer
 {
     // Element storage
     T *elements = new T[capacity];
 
     // Read and write pointers
-    isize r, w;
+    Index r, w;
 
     
     //
@@ -255,6 +278,12 @@ template <class T, isize capacity> struct RingBuffer
     {
         r = (r + n) % capacity;
     }
+
+    void advanceWritePtr(isize n)
+    {
+        assert(n <= free());
+        w = (w + n) % capacity;
+    }
     
     
     //
@@ -271,6 +300,26 @@ template <class T, isize capacity> struct RingBuffer
         return &elements[r];
     }
 
+    T *writeAddr()
+    {
+        return &elements[w];
+    }
+
+    /* Returns the number of elements that can be read or written without
+     * wrapping around. Both indices are loaded once, because the thread on the
+     * other side may move its index at any time.
+     */
+    isize contiguousCount() const
+    {
+        isize r0 = r, w0 = w;
+        return w0 >= r0 ? w0 - r0 : capacity - r0;
+    }
+    isize contiguousFree() const
+    {
+        isize r0 = r, w0 = w;
+        return w0 >= r0 ? capacity - w0 - (r0 == 0) : r0 - w0 - 1;
+    }
+
     const T& current(isize offset) const
     {
         return elements[(r + offset) % capacity];
@@ -17,12 +17,26 @@
 #include "Macros.h"
 #include "MemUtils.h"
 #include "Buffer.h"
+#include <bit>
 #include <vector>
 
 namespace util {
 
 class Serializable { };
 
+/* Arrays of byte-sized integers are stored as a plain sequence of bytes. The
+ * serializers process them with a single memory copy. Arrays of wider types
+ * are still processed element by element, because each element is stored in
+ * big-endian byte order and integers are widened to 64 bit. Booleans are
+ * excluded, because the deserializer has to map nonzero bytes to 'true'.
+ */
+template <class T> using ArrayElement = std::remove_cv_t<std::remove_all_extents_t<T>>;
+
+template <class T> constexpr bool isByteArray =
+std::is_integral_v<ArrayElement<T>> &&
+!std::is_same_v<ArrayElement<T>, bool> &&
+sizeof(ArrayElement<T>) == 1;
+
 //
 // Basic memory buffer I/O
 //
@@ -175,8 +189,15 @@ public:
     template <class T, isize N>
     SerCounter& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (isByteArray<T>) {
+
+            count += isize(sizeof(v));
+
+        } else {
+
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
@@ -268,21 +289,66 @@ public:
 };
 
 
+//
+// Running checksum
+//
+
+/* SerReader and SerWriter compute a checksum on the fly while the data is
+ * processed. Each serialized value is fed into the FNV-1a algorithm in the
+ * format it is stored in. Consecutive bytes (byte arrays, memory blocks, and
+ * strings) are fed in as 64-bit big-endian words. Readers and writers collect
+ * the checksum in the SerChecksum object that has been created most recently
+ * in the same thread. If no such object exists or the object is disabled, no
+ * checksum is computed.
+ */
+class SerChecksum
+{
+    // The checksum object readers and writers currently report to
+    static inline thread_local SerChecksum *active = nullptr;
+
+    // The previously active checksum object
+    SerChecksum *prev;
+
+public:
+
+    u64 hash = fnvInit64();
+
+    SerChecksum(bool enable = true) : prev(active) { active = enable ? this : nullptr; }
+    ~SerChecksum() { active = prev; }
+
+    static SerChecksum *current() { return active; }
+
+    // Feeds a single value into the hash function
+    void update(u64 value) { hash = fnvIt64(hash, value); }
+
+    // Feeds a sequence of bytes into the hash function
+    void update(const u8 *buf, isize len)
+    {
+        auto h = hash;
+        for (; len >= 8; len -= 8) h = fnvIt64(h, read64(buf));
+        for (; len > 0; len--) h = fnvIt64(h, read8(buf));
+        hash = h;
+    }
+};
+
+
 //
 // Reader (Deserializer)
 //
 
-#define DESERIALIZE(type,function) \
+#define DESERIALIZE(type,function,bits) \
 SerReader& operator<<(type& v) \
 { \
-v = (type)function(ptr); \
+auto value = function(ptr); \
+if (checksum) checksum->update(bits(value)); \
+v = (type)value; \
 return *this; \
 }
 
-#define DESERIALIZE8(type)  static_assert(sizeof(type) == 1); DESERIALIZE(type,read8)
-#define DESERIALIZE16(type) static_assert(sizeof(type) == 2); DESERIALIZE(type,read16)
-#define DESERIALIZE64(type) static_assert(sizeof(type) <= 8); DESERIALIZE(type,read64)
-#define DESERIALIZED(type) static_assert(sizeof(type) <= 8); DESERIALIZE(type,readDouble)
+#define DESERIALIZE8(type)  static_assert(sizeof(type) == 1); DESERIALIZE(type,read8,u64)
+#define DESERIALIZE16(type) static_assert(sizeof(type) == 2); DESERIALIZE(type,read16,u64)
+#define DESERIALIZE64(type) static_assert(sizeof(type) <= 8); DESERIALIZE(type,read64,u64)
+#define DESERIALIZED(type) static_assert(sizeof(type) <= 8); DESERIALIZE(type,readDouble,std::bit_cast<u64>)
 
 class SerReader
 {
@@ -290,6 +356,9 @@ public:
 
     const u8 *ptr;
 
+    // Collects the running checksum (may be nullptr)
+    SerChecksum *checksum = SerChecksum::current();
+
     SerReader(const u8 *p) : ptr(p)
     {
     }
@@ -315,13 +384,16 @@ public:
         i64 len;
         *this << len;
         a.init(ptr, isize(len));
+        if (checksum) checksum->update(ptr, isize(len));
         ptr += len;
         return *this;
     }
 
     auto& operator<<(string &v)
     {
+        auto start = ptr;
         v = readString(ptr);
+        if (checksum) checksum->update(start, isize(ptr - start));
         return *this;
     }
 
@@ -342,8 +414,15 @@ public:
     template <class T, isize N>
     SerReader& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (isByteArray<T>) {
+
+            copy(v, isize(sizeof(v)));
+
+        } else {
+
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
@@ -351,6 +430,7 @@ public:
     void copy(void *dst, isize n)
     {
         std::memcpy(dst, (void *)ptr, n);
+        if (checksum) checksum->update(ptr, n);
         ptr += n;
     }
 
@@ -367,17 +447,18 @@ public:
 // Writer (Serializer)
 //
 
-#define SERIALIZE(type,function,cast) \
+#define SERIALIZE(type,function,cast,bits) \
 SerWriter& operator<<(type& v) \
 { \
 function(ptr, (cast)v); \
+if (checksum) checksum->update(bits((cast)v)); \
 return *this; \
 }
 
-#define SERIALIZE8(type)  static_assert(sizeof(type) == 1); SERIALIZE(type,write8,u8)
-#define SERIALIZE16(type) static_assert(sizeof(type) == 2); SERIALIZE(type,write16,u16)
-#define SERIALIZE64(type) static_assert(sizeof(type) <= 8); SERIALIZE(type,write64,u64)
-#define SERIALIZED(type) static_assert(sizeof(type) <= 8); SERIALIZE(type,writeDouble,double)
+#define SERIALIZE8(type)  static_assert(sizeof(type) == 1); SERIALIZE(type,write8,u8,u64)
+#define SERIALIZE16(type) static_assert(sizeof(type) == 2); SERIALIZE(type,write16,u16,u64)
+#define SERIALIZE64(type) static_assert(sizeof(type) <= 8); SERIALIZE(type,write64,u64,u64)
+#define SERIALIZED(type) static_assert(sizeof(type) <= 8); SERIALIZE(type,writeDouble,double,std::bit_cast<u64>)
 
 class SerWriter
 {
@@ -385,6 +466,9 @@ public:
 
     u8 *ptr;
 
+    // Collects the running checksum (may be nullptr)
+    SerChecksum *checksum = SerChecksum::current();
+
     SerWriter(u8 *p) : ptr(p)
     {
     }
@@ -409,13 +493,16 @@ public:
     {
         *this << i64(a.size);
         a.copy(ptr);
+        if (checksum) checksum->update(ptr, a.size);
         ptr += a.size;
         return *this;
     }
 
     auto& operator<<(const string &v)
     {
+        auto start = ptr;
         writeString(ptr, v);
+        if (checksum) checksum->update(start, isize(ptr - start));
         return *this;
     }
 
@@ -433,8 +520,15 @@ public:
     template <class T, isize N>
     SerWriter& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (isByteArray<T>) {
+
+            copy(v, isize(sizeof(v)));
+
+        } else {
+
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
@@ -449,6 +543,7 @@ public:
     void copy(const void *src, isize n)
     {
         std::memcpy((void *)ptr, src, n);
+        if (checksum) checksum->update(ptr, n);
         ptr += n;
     }
 };
@@ -511,8 +606,15 @@ public:
     template <class T, isize N>
     SerResetter& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        if constexpr (isByteArray<T>) {
+
+            std::memset(v, 0, sizeof(v));
+
+        } else {
+
+            for(isize i = 0; i < N; ++i) {
+                *this << v[i];
+            }
         }
         return *this;
     }
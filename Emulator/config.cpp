@@ -74,6 +74,7 @@ debugflag LIP_DEBUG       = 0; // Light pen
 
 // Other components
 debugflag REC_DEBUG       = 0; // Screen recorder
+debugflag INP_DEBUG       = 0; // Input recorder
 debugflag REU_DEBUG       = 0; // REU memory expansion
 
 
@@ -25,12 +25,15 @@
 // Snapshot version number
 #define SNP_MAJOR 4
 #define SNP_MINOR 7
-#define SNP_SUBMINOR 0
+#define SNP_SUBMINOR 2
 #define SNP_BETA 0
 
 // Uncomment these settings in a release build
 #define RELEASEBUILD
 
+// Uncomment this setting to enable the run loop profiler
+// #define PROFILEBUILD
+
 
 //
 // Build settings
@@ -68,6 +71,12 @@ static const bool debugBuild = 1;
 typedef int debugflag;
 #endif
 
+#ifdef PROFILEBUILD
+static const bool profileBuild = 1;
+#else
+static const bool profileBuild = 0;
+#endif
+
 #if VER_BETA == 0
 static const bool betaRelease = 0;
 #else
@@ -136,6 +145,7 @@ extern debugflag LIP_DEBUG;
 
 // Other components
 extern debugflag REC_DEBUG;
+extern debugflag INP_DEBUG;
 extern debugflag REU_DEBUG;
 
 
@@ -16,7 +16,7 @@ class Canvas: Layer {
     var scanlineFilter: ComputeKernel! { return ressourceManager.scanlineFilter }
 
     // Used to determine if the GPU texture needs to be updated
-    var prevBuffer: UnsafeMutablePointer<u32>?
+    var prevFrame = -1
 
     //
     // Textures
@@ -210,8 +210,8 @@ class Canvas: Layer {
         precondition(buffer != nil)
 
         // Only proceed if the emulator delivers a new texture
-        if prevBuffer == buffer { return }
-        prevBuffer = buffer
+        if prevFrame == c64.vic.stableFrameNr { return }
+        prevFrame = c64.vic.stableFrameNr
                 
         // Update the GPU texture
         let w = Int(TEX_WIDTH)
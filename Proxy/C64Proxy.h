@@ -404,6 +404,7 @@
 - (SpriteInfo)getSpriteInfo:(NSInteger)sprite;
 
 @property (readonly) u32 *stableEmuTexture;
+@property (readonly) NSInteger stableFrameNr;
 @property (readonly) u32 *noise;
 
 @end
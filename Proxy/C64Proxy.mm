@@ -535,6 +535,11 @@ using namespace vc64;
     return [self vicii]->stableEmuTexture();
 }
 
+- (NSInteger)stableFrameNr
+{
+    return (NSInteger)[self vicii]->stableFrameNr();
+}
+
 - (NSColor *)color:(NSInteger)nr
 {
     assert (0 <= nr && nr < 16);